@@ -15,12 +15,37 @@ graph_t *graph_create(void)
 /* Check if memory allocation was successful */
 	if (graph)
 	{
-/* Initialize the graph fields */
-/* Number of vertices is set to 0 as the graph is empty */
+/* Initialize the graph fields, the graph has no vertices yet */
 		graph->nb_vertices = 0;
 
 /* The adjacency linked list starts empty, no vertices yet */
 		graph->vertices = NULL;
+		graph->vertices_tail = NULL;
+
+/* The vertex hash index starts empty, its table is allocated lazily */
+		graph->lookup.slots = NULL;
+		graph->lookup.capacity = 0;
+		graph->lookup.size = 0;
+
+/* No memory block is owned by the graph yet */
+		graph->slabs = NULL;
+		graph->slab_table = NULL;
+		graph->nb_slabs = 0;
+		graph->slab_capacity = 0;
+		graph->arena = 0;
+
+/* The table of vertices by index is allocated with the first vertex */
+		graph->vertex_table = NULL;
+		graph->table_capacity = 0;
+
+/* Edges have no reverse adjacency nor weight until they are asked for */
+		graph->reverse = 0;
+		graph->weight_type = GRAPH_UNWEIGHTED;
+
+/* No profiling counters nor edge hash set are attached yet */
+		graph->counters = NULL;
+		graph->edge_set = NULL;
+		graph->unique_edges = 0;
 	}
 
 	return (graph);
@@ -1,5 +1,36 @@
 #include "graphs.h"
 
+/**
+ * graph_reserve_vertex - program that makes room for one more vertex
+ * in the table of vertices by index of a graph
+ *
+ * the table is doubled whenever it is full, so adding a vertex stays
+ * constant time on average
+ *
+ * @graph: a pointer to the graph
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int graph_reserve_vertex(graph_t *graph)
+{
+	vertex_t **table;
+	size_t capacity;
+
+	if (graph->nb_vertices < graph->table_capacity)
+		return (1);
+
+	capacity = graph->table_capacity ? graph->table_capacity * 2 : 16;
+	GRAPH_COUNT(graph, allocations, 1);
+	table = realloc(graph->vertex_table, capacity * sizeof(vertex_t *));
+	if (!table)
+		return (0);
+
+	graph->vertex_table = table;
+	graph->table_capacity = capacity;
+	return (1);
+}
+
 /**
  * graph_add_vertex - program that adds a new vertex to an existing graph
  *
@@ -12,44 +43,40 @@
 
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *current_vertex;
 	vertex_t *new_vertex;
 
 	if (graph == NULL || str == NULL)
 		return (NULL);
-	for (current_vertex = graph->vertices; current_vertex != NULL;
-	     current_vertex = current_vertex->next)
-	{
-		if (strcmp(current_vertex->content, str) == 0)
-			return (NULL);
-	}
-	new_vertex = (vertex_t *)malloc(sizeof(vertex_t));
+	if (vertex_index_find(&graph->lookup, str) != NULL ||
+	    !graph_reserve_vertex(graph))
+		return (NULL);
+	new_vertex = (vertex_t *)graph_alloc(graph, sizeof(vertex_t));
 	if (new_vertex == NULL)
 		return (NULL);
-	new_vertex->content = strdup(str);
+	new_vertex->content = graph_strdup(graph, str);
 	if (new_vertex->content == NULL)
 	{
-		free(new_vertex);
+		graph_free(graph, new_vertex);
 		return (NULL);
 	}
 	new_vertex->index = graph->nb_vertices;
 	new_vertex->nb_edges = 0;
 	new_vertex->edges = NULL;
+	new_vertex->edges_tail = NULL;
+	new_vertex->in_edges = NULL;
 	new_vertex->next = NULL;
-	if (graph->vertices == NULL)
+	new_vertex->prev = graph->vertices_tail;
+	if (!vertex_index_insert(&graph->lookup, new_vertex))
 	{
-		graph->vertices = new_vertex;
+		graph_free(graph, new_vertex->content);
+		graph_free(graph, new_vertex);
+		return (NULL);
 	}
+	if (graph->vertices == NULL)
+		graph->vertices = new_vertex;
 	else
-	{
-		vertex_t *current = graph->vertices;
-
-		while (current->next != NULL)
-		{
-			current = current->next;
-		}
-		current->next = new_vertex;
-	}
-	graph->nb_vertices++;
+		graph->vertices_tail->next = new_vertex;
+	graph->vertices_tail = new_vertex;
+	graph->vertex_table[graph->nb_vertices++] = new_vertex;
 	return (new_vertex);
 }
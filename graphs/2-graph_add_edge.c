@@ -1,8 +1,34 @@
 #include "graphs.h"
 
+/**
+ * vertex_link_edge - program that appends an edge to the edge list
+ * of a vertex
+ *
+ * @src_vertex: The source vertex for the edge
+ * @edge: The edge to append, its dest member must already be set
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_link_edge(vertex_t *src_vertex, edge_t *edge)
+{
+	edge->next = NULL;
+	if (src_vertex->edges_tail)
+		src_vertex->edges_tail->next = edge;
+	else
+		src_vertex->edges = edge;
+	src_vertex->edges_tail = edge;
+	src_vertex->nb_edges++;
+}
+
 /**
  * graph_add_single_edge - program that adds a single directed edge to a vertex
  *
+ * the graph of the vertices is not known here, so the edge is a plain
+ * edge_t, without weight nor links: it may only be added to a graph that
+ * is unweighted, and maintains neither its reverse adjacency nor an edge
+ * hash set (see graph_connect for the other graphs)
+ *
  * @src_vertex: The source vertex for the edge
  * @dest_vertex: The destination vertex for the edge
  *
@@ -11,7 +37,7 @@
 
 edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
 {
-	edge_t *new_edge = NULL, *temp_edge = NULL;
+	edge_t *new_edge = NULL;
 
 	if (!src_vertex || !dest_vertex)
 		return (NULL);
@@ -20,18 +46,62 @@ edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
 	if (!new_edge)
 		return (NULL);
 	new_edge->dest = dest_vertex;
-	new_edge->next = NULL;
+	vertex_link_edge(src_vertex, new_edge);
 
-	temp_edge = src_vertex->edges;
-	while (temp_edge && temp_edge->next)
-		temp_edge = temp_edge->next;
+	return (new_edge);
+}
 
-	if (temp_edge)
-		temp_edge->next = new_edge;
-	else
-		src_vertex->edges = new_edge;
-	src_vertex->nb_edges++;
+/**
+ * graph_connect - program that adds a directed edge between two vertices
+ * of a graph
+ *
+ * the edge is allocated with graph_alloc, from the arena of the graph if
+ * it has one, as a weighted_edge_t of weight 0 if the graph is weighted;
+ * when the graph maintains its reverse adjacency, a node is also added to
+ * the in_edges list of the destination vertex (see graph_link_edge), and
+ * when it maintains an edge hash set, the edge is recorded in it; in
+ * unique-edges mode, an existing edge between the vertices is returned
+ * instead of a new one
+ *
+ * @graph: the graph the vertices belong to
+ * @src_vertex: The source vertex for the edge
+ * @dest_vertex: The destination vertex for the edge
+ *
+ * Return: a pointer to the new edge, or NULL on failure
+ */
+
+edge_t *graph_connect(graph_t *graph, vertex_t *src_vertex,
+		      vertex_t *dest_vertex)
+{
+	edge_t *new_edge = NULL, *in_edge = NULL;
+
+	if (graph->unique_edges)
+	{
+		new_edge = graph_find_edge(graph, src_vertex, dest_vertex);
+		if (new_edge)
+			return (new_edge);
+	}
+	if (graph->edge_set && !edge_set_reserve(graph->edge_set, 1))
+		return (NULL);
+	new_edge = graph_alloc(graph, graph_edge_size(graph));
+	if (new_edge == NULL)
+		return (NULL);
+	if (graph->weight_type != GRAPH_UNWEIGHTED)
+		memset(&EDGE_WEIGHT(new_edge), 0, sizeof(graph_weight_t));
+	if (graph->reverse)
+	{
+		in_edge = graph_alloc(graph, sizeof(in_edge_t));
+		if (in_edge == NULL)
+		{
+			graph_free(graph, new_edge);
+			return (NULL);
+		}
+	}
 
+	new_edge->dest = dest_vertex;
+	graph_link_edge(graph, src_vertex, new_edge, in_edge);
+	if (graph->edge_set)
+		edge_set_add(graph->edge_set, src_vertex, new_edge);
 	return (new_edge);
 }
 
@@ -43,36 +113,32 @@ edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex)
  * @dest: the content of the destination vertex
  * @type: the type of edge (UNIDIRECTIONAL or BIDIRECTIONAL)
  *
- * Return: 1 on success, 0 on failure
+ * Return: 1 on success, 0 on failure, including when @src and @dest are
+ * the same vertex
  */
 
 int graph_add_edge(graph_t *graph, const char *src,
 		   const char *dest, edge_type_t type)
 {
-	vertex_t *temp_vertex = NULL, *src_vertex = NULL, *dest_vertex = NULL;
+	vertex_t *src_vertex = NULL, *dest_vertex = NULL;
 
 	if (!graph || !src || !dest ||
 	    type < UNIDIRECTIONAL || type > BIDIRECTIONAL)
 		return (0);
 
-	for (temp_vertex = graph->vertices; temp_vertex; temp_vertex =
-		     temp_vertex->next)
-	{
-		if (strcmp(temp_vertex->content, src) == 0)
-			src_vertex = temp_vertex;
-		else if (strcmp(temp_vertex->content, dest) == 0)
-			dest_vertex = temp_vertex;
-	}
+	src_vertex = vertex_index_find(&graph->lookup, src);
+	dest_vertex = vertex_index_find(&graph->lookup, dest);
 
-	if (!src_vertex || !dest_vertex)
+/* A vertex cannot be linked to itself */
+	if (!src_vertex || !dest_vertex || src_vertex == dest_vertex)
 		return (0);
 
-	if (graph_add_single_edge(src_vertex, dest_vertex) == NULL)
+	if (!graph_connect(graph, src_vertex, dest_vertex))
 		return (0);
 
 	if (type == BIDIRECTIONAL)
 	{
-		if (graph_add_single_edge(dest_vertex, src_vertex) == NULL)
+		if (!graph_connect(graph, dest_vertex, src_vertex))
 			return (0);
 	}
 
@@ -4,6 +4,11 @@
  * graph_delete - program that frees the memory occupied by a graph
  * and its vertices
  *
+ * the vertices, contents and edges of a graph created with
+ * graph_create_arena are not freed one by one, they are released
+ * with the memory blocks of the graph, as are the edges inserted by
+ * batches and the vertices and edges moved by graph_relabel
+ *
  * @graph: a pointer to the graph to be deleted
  */
 
@@ -15,7 +20,7 @@ void graph_delete(graph_t *graph)
 	if (!graph)
 		return;
 
-	current_vertex = graph->vertices;
+	current_vertex = graph->arena ? NULL : graph->vertices;
 	while (current_vertex)
 	{
 		next_vertex = current_vertex->next;
@@ -27,13 +32,25 @@ void graph_delete(graph_t *graph)
 		while (current_edge)
 		{
 			next_edge = current_edge->next;
-			free(current_edge);
+			graph_free(graph, current_edge);
+			current_edge = next_edge;
+		}
+
+		current_edge = current_vertex->in_edges;
+		while (current_edge)
+		{
+			next_edge = current_edge->next;
+			graph_free(graph, current_edge);
 			current_edge = next_edge;
 		}
 
-		free(current_vertex);
+		graph_free(graph, current_vertex);
 		current_vertex = next_vertex;
 	}
 
+	vertex_index_clear(&graph->lookup);
+	graph_clear_edges(graph);
+	free(graph->vertex_table);
+	graph_slab_free(graph);
 	free(graph);
 }
@@ -1,85 +1,102 @@
 #include "graphs.h"
 
 /**
- * traverseVerticesRecursively - recursive function that travels through
- * vertices in a graph
+ * dfs_stack_push - program that pushes a new frame on a depth-first
+ * traversal stack
  *
- * @vertex: the starting vertex to traverse from
- * @visited_flags: an array indicating whether vertices have been visited
- * @current_depth: the current depth level in traversal
- * @vertex_action: a function to perform an action on each vertex
+ * the array of frames is doubled whenever it is full, so the depth of
+ * the traversal is only bounded by the available memory, not by the
+ * size of the C stack; each growth is counted as an allocation in the
+ * profiling counters of the stack, if any
  *
- * Return: the maximum depth reached during traversal
+ * @stack: a pointer to the stack
+ * @vertex: the vertex to explore, starting from its first edge
+ *
+ * Return: 1 on success, 0 if memory allocation fails
  */
 
-size_t traverseVerticesRecursively(vertex_t *vertex, char *visited_flags,
-				   size_t current_depth, void (*vertex_action)
-				   (const vertex_t *v, size_t depth))
+int dfs_stack_push(dfs_stack_t *stack, vertex_t *vertex)
 {
-	size_t current_depth_new = 0, max_depth = current_depth, flag = 0;
-	edge_t *edge_header = NULL;
-
-	if (!vertex)
-		return (current_depth - 1);
+	dfs_frame_t *frames;
+	size_t capacity;
 
-	edge_header = vertex->edges;
-	while (edge_header)
+	if (stack->size == stack->capacity)
 	{
-		if (visited_flags[edge_header->dest->index] == 0)
-		{
-			vertex_action(edge_header->dest, current_depth);
-			visited_flags[edge_header->dest->index] = 1;
-			current_depth_new = traverseVerticesRecursively
-				(edge_header->dest, visited_flags,
-				 current_depth + 1, vertex_action);
-
-			if (current_depth_new > max_depth)
-				max_depth = current_depth_new;
-			flag = 1;
-		}
-		edge_header = edge_header->next;
+		capacity = stack->capacity ? stack->capacity * 2 : 64;
+		frames = realloc(stack->frames, capacity * sizeof(dfs_frame_t));
+		if (!frames)
+			return (0);
+		stack->frames = frames;
+		stack->capacity = capacity;
+		if (stack->counters)
+			stack->counters->allocations++;
 	}
-	if (flag)
-		return (max_depth);
-	return (max_depth - 1);
+
+	stack->frames[stack->size].vertex = vertex;
+	stack->frames[stack->size].edge = vertex->edges;
+	stack->size++;
+	return (1);
 }
 
+
+
 /**
  * depth_first_traverse - program that traverses a graph using
  * depth-first search
  *
+ * the traversal starts from the first vertex of the graph; each vertex
+ * is handed to @action when it is discovered, with its depth, which is
+ * the height of the stack of frames at that moment;
+ * visited vertices are tracked in a bitset sized from the number of
+ * vertices of the graph, and reported to the profiling counters of the
+ * graph once the traversal is over, unless it failed
+ *
  * @graph: the graph to traverse
  * @action: a function to perform an action on each vertex along with its depth
  *
- * Return: the maximum depth reached during traversal
+ * Return: the maximum depth reached during traversal, or 0 on failure
  */
 
 size_t depth_first_traverse(const graph_t *graph,
 			    void (*action)(const vertex_t *v, size_t depth))
 {
-	vertex_t *current_vertex = NULL;
-	char visited_flags[2048] = {0};
-	size_t current_depth = 0, max_depth = 0;
+	dfs_stack_t stack = {NULL, 0, 0, NULL};
+	dfs_frame_t *frame;
+	unsigned long *visited;
+	vertex_t *dest;
+	size_t max_depth = 0;
+	int ok;
 
-	if (!graph || !action)
+	if (!graph || !action || !graph->vertices)
+		return (0);
+	visited = calloc(BITSET_WORDS(graph->nb_vertices),
+			 sizeof(unsigned long));
+	if (!visited)
 		return (0);
 
-	current_vertex = graph->vertices;
-
-	while (current_vertex)
+	stack.counters = graph->counters;
+	BITSET_SET(visited, graph->vertices->index);
+	action(graph->vertices, 0);
+	ok = dfs_stack_push(&stack, graph->vertices);
+	while (ok && stack.size)
 	{
-		if (visited_flags[current_vertex->index] == 0)
+		frame = &stack.frames[stack.size - 1];
+		if (!frame->edge)
 		{
-			action(current_vertex, 0);
-			visited_flags[current_vertex->index] = 1;
-			current_depth = traverseVerticesRecursively
-				(current_vertex, visited_flags, 1, action);
-
-			if (current_depth > max_depth)
-				max_depth = current_depth;
+			stack.size--;
+			continue;
 		}
-		current_vertex = current_vertex->next;
-		break;
+		dest = frame->edge->dest;
+		frame->edge = frame->edge->next;
+		if (BITSET_TEST(visited, dest->index))
+			continue;
+		BITSET_SET(visited, dest->index);
+		action(dest, stack.size);
+		max_depth = (stack.size > max_depth) ? stack.size : max_depth;
+		ok = dfs_stack_push(&stack, dest);
 	}
-	return (max_depth);
+	graph_count_traversal(graph, ok ? visited : NULL, 1);
+	free(stack.frames);
+	free(visited);
+	return (ok ? max_depth : 0);
 }
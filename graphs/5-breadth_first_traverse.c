@@ -1,13 +1,11 @@
 #include "graphs.h"
 
 /**
- * freeQueue - program that frees all the memory allocated for the queue
- * and its nodes
+ * freeQueue - program that frees the memory allocated for the queue
  *
- * this function iterates through each node in the queue, freeing them
- * individually, and finally frees the queue itself;
- * it ensures that all the memory allocated for queue management is properly
- * released
+ * this function releases the array backing the ring buffer and the
+ * queue itself; the vertices it still references belong to the graph
+ * and are not freed
  *
  * @queue: a pointer to the 'GraphQueue' structure to be freed
  *
@@ -16,15 +14,10 @@
 
 void freeQueue(GraphQueue *queue)
 {
-	GraphQueueNode *currentNode, *tempNode;
+	if (!queue)
+		return;
 
-	currentNode = queue->head;
-	while (currentNode)
-	{
-		tempNode = currentNode;
-		currentNode = currentNode->next;
-		free(tempNode);
-	}
+	free(queue->vertices);
 	free(queue);
 }
 
@@ -33,40 +26,22 @@ void freeQueue(GraphQueue *queue)
 /**
  * pushToQueue - program that adds a new vertex to the queue
  *
- * this function creates a new 'GraphQueueNode', assigns the provided vertex
- * and depth to it, and adds it to the end of the queue;
- * it handles memory allocation for the new node and updates the queue's tail;
- * in case of memory allocation failure, it ensures that the queue is properly
- * freed
+ * this function stores the vertex in the slot following the last vertex
+ * of the ring buffer, wrapping around at the end of the array;
+ * no memory is allocated, the buffer is sized when the queue is created
  *
  * @queue: a pointer to the GraphQueue where the vertex will be added
  * @vertex: a pointer to the vertex to be added to the queue
- * @depth: the depth level of the vertex in the graph traversal
  *
- * Return: 1 if the vertex is successfully added, 0 if an error occurs
+ * Return: 1 if the vertex is successfully added, 0 if the queue is full
  */
 
-int pushToQueue(GraphQueue *queue, vertex_t *vertex, size_t depth)
+int pushToQueue(GraphQueue *queue, vertex_t *vertex)
 {
-	GraphQueueNode *newNode;
-
-	newNode = calloc(1, sizeof(GraphQueueNode));
-	if (!newNode)
-	{
-		freeQueue(queue);
+	if (queue->size == queue->capacity)
 		return (0);
-	}
-	newNode->vertex = vertex;
-	newNode->depth = depth;
-	if (!queue->tail)
-	{
-		queue->tail = queue->head = newNode;
-	}
-	else
-	{
-		queue->tail->next = newNode;
-		queue->tail = newNode;
-	}
+
+	queue->vertices[(queue->head + queue->size) % queue->capacity] = vertex;
 	queue->size++;
 	return (1);
 }
@@ -77,36 +52,23 @@ int pushToQueue(GraphQueue *queue, vertex_t *vertex, size_t depth)
  * popFromQueue - program that removes and retrieves a vertex
  * from the front of the queue
  *
- * this function removes the node at the front of the queue, retrieves
- * the vertex and its depth, and then frees the memory of the node;
- * it adjusts the head of the queue and ensures the correct management
- * of the queue's size
+ * this function retrieves the vertex at the front of the ring buffer
+ * and moves the head forward, wrapping around at the end of the array
  *
  * @queue: a pointer to the 'GraphQueue' from which the vertex will be removed
  * @vertex: a pointer to store the removed vertex
- * @depth: a pointer to store the depth of the removed vertex
  *
  * Return: 1 if the vertex is successfully removed, 0 if the queue is empty
  */
 
-int popFromQueue(GraphQueue *queue, vertex_t **vertex, size_t *depth)
+int popFromQueue(GraphQueue *queue, vertex_t **vertex)
 {
-	GraphQueueNode *frontNode;
-
-	if (!queue || !queue->head)
+	if (!queue || !queue->size)
 		return (0);
 
-	frontNode = queue->head;
-	queue->head = queue->head->next;
-
-	if (!queue->head)
-		queue->tail = NULL;
-
-	*vertex = frontNode->vertex;
-	*depth = frontNode->depth;
+	*vertex = queue->vertices[queue->head];
+	queue->head = (queue->head + 1) % queue->capacity;
 	queue->size--;
-	free(frontNode);
-
 	return (1);
 }
 
@@ -123,24 +85,22 @@ int popFromQueue(GraphQueue *queue, vertex_t **vertex, size_t *depth)
  *
  * @queue: the queue used in the breadth-first traversal
  * @vertex: the current vertex being processed
- * @currentDepth: the depth of the current vertex in the traversal
- * @visited: an array indicating whether a vertex has been visited
+ * @visited: a bitset indicating whether a vertex has been visited
  *
  * Return: nothing (void)
  */
 
 void processEdges(GraphQueue *queue, const vertex_t *vertex,
-		  size_t currentDepth, size_t *visited)
+		  unsigned long *visited)
 {
 	edge_t *currentEdge = vertex->edges;
 
 	while (currentEdge)
 	{
-		if (!visited[currentEdge->dest->index])
+		if (!BITSET_TEST(visited, currentEdge->dest->index))
 		{
-			visited[currentEdge->dest->index] = 1;
-			pushToQueue(queue, currentEdge->dest,
-				    currentDepth + 1);
+			BITSET_SET(visited, currentEdge->dest->index);
+			pushToQueue(queue, currentEdge->dest);
 		}
 		currentEdge = currentEdge->next;
 	}
@@ -152,13 +112,15 @@ void processEdges(GraphQueue *queue, const vertex_t *vertex,
  * breadth_first_traverse - program that performs a breadth-first traversal
  * of a graph
  *
- * this function traverses a graph starting from a given vertex and explores
- * all the neighboring vertices at the present depth before moving on to
- * the vertices at the next depth level;
- * it uses a queue to keep track of vertices to be processed and an array
- * to mark visited vertices;
+ * this function traverses a graph starting from its first vertex and
+ * explores all the neighboring vertices at the present depth before moving
+ * on to the vertices at the next depth level;
+ * it uses a ring buffer sized from the number of vertices to keep track of
+ * vertices to be processed and a bitset to mark visited vertices, so the
+ * whole traversal performs a constant number of allocations;
  * the function applies a provided action to each vertex and tracks the maximum
- * depth reached during traversal
+ * depth reached during traversal, and reports the visited vertices to the
+ * profiling counters of the graph once the traversal is over
  *
  * @graph: the graph to be traversed
  * @action: a function to be called on each vertex during traversal
@@ -171,42 +133,42 @@ size_t breadth_first_traverse(const graph_t *graph,
 {
 	GraphQueue *queue;
 	vertex_t *currentVertex;
-	size_t maxDepth = 0, currentDepth, i, queueSize;
-	size_t *visited;
+	size_t currentDepth = 0, i, queueSize;
+	unsigned long *visited;
 
 	if (!graph || !action || !graph->nb_vertices)
 		return (0);
 
-	visited = calloc(graph->nb_vertices, sizeof(size_t));
-
-	if (!visited)
-		return (0);
-
+	visited = calloc(BITSET_WORDS(graph->nb_vertices),
+			 sizeof(unsigned long));
 	queue = calloc(1, sizeof(GraphQueue));
-
-	if (!queue)
+	if (queue)
+		queue->vertices = malloc(graph->nb_vertices *
+					 sizeof(vertex_t *));
+	if (!visited || !queue || !queue->vertices)
 	{
 		free(visited);
+		freeQueue(queue);
 		return (0);
 	}
+	queue->capacity = graph->nb_vertices;
 
-	visited[graph->vertices->index] = 1;
-	pushToQueue(queue, graph->vertices, 0);
+	BITSET_SET(visited, graph->vertices->index);
+	pushToQueue(queue, graph->vertices);
 
-	while (queue->size)
+	for (; queue->size; currentDepth++)
 	{
 		queueSize = queue->size;
 
 		for (i = 0; i < queueSize; i++)
 		{
-			popFromQueue(queue, &currentVertex, &currentDepth);
+			popFromQueue(queue, &currentVertex);
 			action(currentVertex, currentDepth);
-			maxDepth = (maxDepth > currentDepth) ? maxDepth : currentDepth;
-			processEdges(queue, currentVertex, currentDepth, visited);
+			processEdges(queue, currentVertex, visited);
 		}
 	}
+	graph_count_traversal(graph, visited, 3);
 	free(visited);
 	freeQueue(queue);
-	return (maxDepth);
+	return (currentDepth - 1);
 }
-
@@ -0,0 +1,187 @@
+#include "graphs.h"
+
+/**
+ * edge_set_hash - program that computes the hash of a pair of vertices
+ *
+ * the addresses of the vertices are mixed with two odd multipliers, then
+ * the high bits are folded onto the low ones, which linear probing uses
+ *
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ *
+ * Return: the hash of the pair
+ */
+
+size_t edge_set_hash(const vertex_t *src_vertex, const vertex_t *dest_vertex)
+{
+	unsigned long hash;
+
+	hash = (unsigned long)src_vertex * 0x9E3779B97F4A7C15UL ^
+		(unsigned long)dest_vertex * 0xC2B2AE3D27D4EB4FUL;
+	hash ^= hash >> 29;
+	hash *= 0xBF58476D1CE4E5B9UL;
+	hash ^= hash >> 32;
+
+	return ((size_t)hash);
+}
+
+
+
+/**
+ * edge_set_find - program that looks up a pair of vertices in an edge set
+ *
+ * @set: a pointer to the set to search
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ *
+ * Return: a pointer to the slot of the pair, or NULL if there is no edge
+ * from @src_vertex to @dest_vertex
+ */
+
+edge_slot_t *edge_set_find(const edge_set_t *set, const vertex_t *src_vertex,
+			   const vertex_t *dest_vertex)
+{
+	size_t i, mask;
+
+	if (!set->size)
+		return (NULL);
+
+	mask = set->capacity - 1;
+	for (i = edge_set_hash(src_vertex, dest_vertex) & mask;
+	     set->slots[i].src; i = (i + 1) & mask)
+	{
+		if (set->slots[i].src == src_vertex &&
+		    set->slots[i].dest == dest_vertex)
+			return (&set->slots[i]);
+	}
+
+	return (NULL);
+}
+
+
+
+/**
+ * edge_set_reserve - program that makes room in an edge set
+ *
+ * the table is grown beforehand so that @count more pairs can be added
+ * with edge_set_add, which never allocates, without its load factor
+ * exceeding 70%
+ *
+ * @set: a pointer to the set
+ * @count: the number of pairs about to be added
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int edge_set_reserve(edge_set_t *set, size_t count)
+{
+	edge_slot_t *slots;
+	size_t capacity = set->capacity ? set->capacity : 16, i, j;
+
+	while ((set->size + count) * 10 > capacity * 7)
+		capacity *= 2;
+	if (capacity == set->capacity)
+		return (1);
+
+	slots = calloc(capacity, sizeof(edge_slot_t));
+	if (!slots)
+		return (0);
+	for (i = 0; i < set->capacity; i++)
+	{
+		if (!set->slots[i].src)
+			continue;
+		j = edge_set_hash(set->slots[i].src, set->slots[i].dest) &
+			(capacity - 1);
+		while (slots[j].src)
+			j = (j + 1) & (capacity - 1);
+		slots[j] = set->slots[i];
+	}
+
+	free(set->slots);
+	set->slots = slots;
+	set->capacity = capacity;
+	return (1);
+}
+
+
+
+/**
+ * edge_set_add - program that records an edge in an edge set
+ *
+ * room must have been made beforehand with edge_set_reserve
+ *
+ * @set: a pointer to the set
+ * @src_vertex: the source vertex of the edge
+ * @edge: the edge
+ *
+ * Return: nothing (void)
+ */
+
+void edge_set_add(edge_set_t *set, const vertex_t *src_vertex, edge_t *edge)
+{
+	size_t i, mask = set->capacity - 1;
+
+	for (i = edge_set_hash(src_vertex, edge->dest) & mask;
+	     set->slots[i].src; i = (i + 1) & mask)
+	{
+		if (set->slots[i].src == src_vertex &&
+		    set->slots[i].dest == edge->dest)
+		{
+			set->slots[i].count++;
+			return;
+		}
+	}
+
+	set->slots[i].src = src_vertex;
+	set->slots[i].dest = edge->dest;
+	set->slots[i].edge = edge;
+	set->slots[i].count = 1;
+	set->size++;
+}
+
+
+
+/**
+ * edge_set_remove - program that forgets an edge in an edge set
+ *
+ * the edge must already be unlinked from the edge list of its source
+ * vertex; if parallel edges remain and the slot pointed to this one, it
+ * is pointed to the first remaining one; once the last edge of a pair is
+ * gone, its slot is emptied with backward-shift deletion, as in
+ * vertex_index_remove
+ *
+ * @set: a pointer to the set
+ * @src_vertex: the source vertex of the edge
+ * @edge: the removed edge
+ *
+ * Return: nothing (void)
+ */
+
+void edge_set_remove(edge_set_t *set, const vertex_t *src_vertex,
+		     const edge_t *edge)
+{
+	edge_slot_t *slot = edge_set_find(set, src_vertex, edge->dest);
+	size_t mask = set->capacity - 1, hole, i, home;
+
+	if (!slot)
+		return;
+	if (--slot->count)
+	{
+		if (slot->edge == edge)
+			slot->edge = vertex_find_edge(src_vertex, edge->dest);
+		return;
+	}
+
+	hole = slot - set->slots;
+	for (i = (hole + 1) & mask; set->slots[i].src; i = (i + 1) & mask)
+	{
+		home = edge_set_hash(set->slots[i].src, set->slots[i].dest) &
+			mask;
+		if (((i - home) & mask) < ((i - hole) & mask))
+			continue;
+		set->slots[hole] = set->slots[i];
+		hole = i;
+	}
+	set->slots[hole].src = NULL;
+	set->size--;
+}
@@ -0,0 +1,220 @@
+#include "graphs.h"
+
+/**
+ * batch_resolve - program that resolves the vertices of a batch of edges
+ *
+ * every edge of the batch is turned into one pair of vertices, or two for
+ * a bidirectional edge; nothing is linked yet, so a batch referring to an
+ * unknown vertex, or linking a vertex to itself as graph_add_edge refuses
+ * to, fails without modifying the edges of the graph
+ *
+ * @graph: the graph the edges are inserted in
+ * @edges: the array of edges to resolve
+ * @count: the number of edges in @edges
+ * @flags: the flags of the batch, see graph_add_edges_batch
+ * @pairs: an array of at least 2 * @count pairs to fill
+ * @nb_pairs: a pointer to store the number of pairs filled
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int batch_resolve(graph_t *graph, const edge_spec_t *edges, size_t count,
+		  int flags, edge_pair_t *pairs, size_t *nb_pairs)
+{
+	vertex_t *src, *dest;
+	size_t i, n = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		if (!edges[i].src || !edges[i].dest ||
+		    edges[i].type < UNIDIRECTIONAL ||
+		    edges[i].type > BIDIRECTIONAL)
+			return (0);
+
+		src = vertex_index_find(&graph->lookup, edges[i].src);
+		if (!src && (flags & GRAPH_BATCH_CREATE))
+			src = graph_add_vertex(graph, edges[i].src);
+		dest = vertex_index_find(&graph->lookup, edges[i].dest);
+		if (!dest && (flags & GRAPH_BATCH_CREATE))
+			dest = graph_add_vertex(graph, edges[i].dest);
+		if (!src || !dest || src == dest)
+			return (0);
+
+		pairs[n].src = src;
+		pairs[n++].dest = dest;
+		if (edges[i].type == BIDIRECTIONAL)
+		{
+			pairs[n].src = dest;
+			pairs[n++].dest = src;
+		}
+	}
+
+	*nb_pairs = n;
+	return (1);
+}
+
+
+
+/**
+ * edge_pair_cmp - program that compares two resolved edges, by index
+ * of their source vertex first, then by index of their destination vertex
+ *
+ * @a: a pointer to the first edge_pair_t
+ * @b: a pointer to the second edge_pair_t
+ *
+ * Return: a negative value, 0 or a positive value if @a sorts before,
+ * equal to, or after @b
+ */
+
+int edge_pair_cmp(const void *a, const void *b)
+{
+	const edge_pair_t *pa = a, *pb = b;
+
+	if (pa->src->index != pb->src->index)
+		return ((pa->src->index < pb->src->index) ? -1 : 1);
+	if (pa->dest->index != pb->dest->index)
+		return ((pa->dest->index < pb->dest->index) ? -1 : 1);
+	return (0);
+}
+
+
+
+/**
+ * batch_dedup - program that removes the parallel edges of a sorted batch
+ *
+ * in unique-edges mode, the edges already in the graph are removed too
+ *
+ * @graph: the graph the edges are inserted in
+ * @pairs: the array of resolved edges, sorted with edge_pair_cmp
+ * @nb_pairs: the number of edges in @pairs
+ *
+ * Return: the number of distinct edges left at the start of @pairs
+ */
+
+size_t batch_dedup(const graph_t *graph, edge_pair_t *pairs,
+		   size_t nb_pairs)
+{
+	size_t i, kept;
+
+	for (i = 0, kept = 0; i < nb_pairs; i++)
+	{
+		if (kept && pairs[i].src == pairs[kept - 1].src &&
+		    pairs[i].dest == pairs[kept - 1].dest)
+			continue;
+		if (graph->unique_edges &&
+		    graph_find_edge(graph, pairs[i].src, pairs[i].dest))
+			continue;
+		pairs[kept++] = pairs[i];
+	}
+
+	return (kept);
+}
+
+
+
+/**
+ * batch_link - program that appends a batch of resolved edges to the edge
+ * lists of their source vertices
+ *
+ * all the edges, and their reverse adjacency nodes if the graph maintains
+ * them, are carved out of a single slab owned by the graph, so the whole
+ * batch costs one allocation; the edges of a weighted graph are
+ * weighted_edge_t of weight 0, and the edge hash set of the graph, if
+ * any, is grown once for the whole batch
+ *
+ * @graph: the graph the edges are inserted in
+ * @pairs: the array of resolved edges
+ * @nb_pairs: the number of edges in @pairs
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int batch_link(graph_t *graph, const edge_pair_t *pairs, size_t nb_pairs)
+{
+	size_t i, size = graph_edge_size(graph), block_size;
+	in_edge_t *in_edges;
+	edge_t *edge;
+	char *block;
+
+	if (!nb_pairs)
+		return (1);
+	if (graph->edge_set && !edge_set_reserve(graph->edge_set, nb_pairs))
+		return (0);
+	block_size = nb_pairs * size;
+	if (graph->reverse)
+		block_size += nb_pairs * sizeof(in_edge_t);
+	block = graph_slab_alloc(graph, block_size);
+	if (!block)
+		return (0);
+	if (graph->weight_type != GRAPH_UNWEIGHTED)
+		memset(block, 0, nb_pairs * size);
+	in_edges = (in_edge_t *)(block + nb_pairs * size);
+
+	for (i = 0; i < nb_pairs; i++)
+	{
+		edge = (edge_t *)(block + i * size);
+		edge->dest = pairs[i].dest;
+		graph_link_edge(graph, pairs[i].src, edge, &in_edges[i].edge);
+		if (graph->edge_set)
+			edge_set_add(graph->edge_set, pairs[i].src, edge);
+	}
+
+	return (1);
+}
+
+
+
+/**
+ * graph_add_edges_batch - program that adds many edges to a graph at once
+ *
+ * all the vertex contents are resolved through the vertex hash index
+ * before any edge is linked, then the edges are allocated from a single
+ * slab owned by the graph;
+ * with GRAPH_BATCH_DEDUP, the batch is sorted by source then destination
+ * index and its parallel edges are dropped, so each source vertex receives
+ * its new edges by increasing destination index (edges already in the
+ * graph are only dropped in unique-edges mode, which implies
+ * GRAPH_BATCH_DEDUP); otherwise the edges keep the order of @edges;
+ * with GRAPH_BATCH_CREATE, missing vertices are added to the graph;
+ * as with graph_add_edge, a vertex cannot be linked to itself
+ *
+ * @graph: the graph to which the edges should be added
+ * @edges: the array of edges to add
+ * @count: the number of edges in @edges
+ * @flags: a combination of GRAPH_BATCH_DEDUP and GRAPH_BATCH_CREATE
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_add_edges_batch(graph_t *graph, const edge_spec_t *edges,
+			  size_t count, int flags)
+{
+	edge_pair_t *pairs;
+	size_t nb_pairs = 0;
+	int ret;
+
+	if (!graph || (!edges && count))
+		return (0);
+	if (!count)
+		return (1);
+	if (count > SIZE_MAX / (2 * sizeof(edge_pair_t)))
+		return (0);
+
+	pairs = malloc(count * 2 * sizeof(edge_pair_t));
+	if (!pairs)
+		return (0);
+	if (!batch_resolve(graph, edges, count, flags, pairs, &nb_pairs))
+	{
+		free(pairs);
+		return (0);
+	}
+
+	if ((flags & GRAPH_BATCH_DEDUP) || graph->unique_edges)
+	{
+		qsort(pairs, nb_pairs, sizeof(edge_pair_t), edge_pair_cmp);
+		nb_pairs = batch_dedup(graph, pairs, nb_pairs);
+	}
+	ret = batch_link(graph, pairs, nb_pairs);
+	free(pairs);
+	return (ret);
+}
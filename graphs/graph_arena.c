@@ -0,0 +1,92 @@
+#include "graphs.h"
+
+/**
+ * graph_create_arena - program that creates an empty graph whose memory
+ * is managed as an arena
+ *
+ * every vertex, edge and content string added to the graph through
+ * graph_add_vertex, graph_add_edge or graph_add_edges_batch is carved out
+ * of chunks of GRAPH_ARENA_CHUNK bytes owned by the graph, so building the
+ * graph seldom calls malloc, and graph_delete releases it with one free
+ * per chunk;
+ * edges created directly with graph_add_single_edge are not owned by the
+ * arena and must not be used on such a graph
+ *
+ * Return: a pointer to the newly created graph_t structure on success,
+ * or NULL if memory allocation fails
+ */
+
+graph_t *graph_create_arena(void)
+{
+	graph_t *graph = graph_create();
+
+	if (graph)
+		graph->arena = 1;
+
+	return (graph);
+}
+
+
+
+/**
+ * graph_alloc - program that allocates memory for an object of a graph
+ *
+ * @graph: the graph the object belongs to
+ * @size: the size of the object, in bytes
+ *
+ * Return: a pointer to memory from the arena of the graph if it has one,
+ * from malloc otherwise, or NULL if memory allocation fails
+ */
+
+void *graph_alloc(graph_t *graph, size_t size)
+{
+	if (graph->arena)
+		return (graph_slab_alloc(graph, size));
+
+	GRAPH_COUNT(graph, allocations, 1);
+	return (malloc(size));
+}
+
+
+
+/**
+ * graph_strdup - program that duplicates a string for a graph
+ *
+ * @graph: the graph the string belongs to
+ * @str: the string to duplicate
+ *
+ * Return: a pointer to the copy, allocated with graph_alloc,
+ * or NULL if memory allocation fails
+ */
+
+char *graph_strdup(graph_t *graph, const char *str)
+{
+	size_t len = strlen(str) + 1;
+	char *copy;
+
+	copy = graph_alloc(graph, len);
+	if (copy)
+		memcpy(copy, str, len);
+
+	return (copy);
+}
+
+
+
+/**
+ * graph_free - program that releases the memory of an object of a graph
+ *
+ * memory that belongs to a block owned by the graph is left untouched,
+ * it is released with the block when the graph is deleted
+ *
+ * @graph: the graph the object belongs to
+ * @ptr: a pointer to the object
+ *
+ * Return: nothing (void)
+ */
+
+void graph_free(graph_t *graph, void *ptr)
+{
+	if (!graph->arena && !graph_slab_owns(graph, ptr))
+		free(ptr);
+}
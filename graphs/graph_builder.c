@@ -0,0 +1,171 @@
+#include "graphs.h"
+
+/**
+ * graph_builder_create - program that creates a graph builder, in which
+ * several threads can insert vertices and edges at the same time
+ *
+ * Return: a pointer to the builder, or NULL on failure
+ */
+
+graph_builder_t *graph_builder_create(void)
+{
+	graph_builder_t *builder;
+	size_t i;
+
+	builder = calloc(1, sizeof(graph_builder_t));
+	if (builder)
+		builder->graph = graph_create();
+	if (!builder || !builder->graph)
+	{
+		free(builder);
+		return (NULL);
+	}
+
+	for (i = 0; i < GRAPH_BUILDER_SHARDS; i++)
+	{
+		if (pthread_mutex_init(&builder->shards[i].lock, NULL))
+		{
+			builder_free_shards(builder, i);
+			graph_delete(builder->graph);
+			free(builder);
+			return (NULL);
+		}
+	}
+
+	return (builder);
+}
+
+
+
+/**
+ * graph_builder_add_vertex - program that finds or adds a vertex in a graph
+ * builder, safely from any thread
+ *
+ * only the shard the content hashes to is locked; the vertex is given its
+ * index with an atomic increment once it is in the index, so the indices
+ * stay in [0, nb_vertices) whatever the failures
+ *
+ * @builder: the builder
+ * @str: the string to store in the vertex
+ *
+ * Return: a pointer to the vertex holding @str, created if needed,
+ * or NULL on failure
+ */
+
+vertex_t *graph_builder_add_vertex(graph_builder_t *builder, const char *str)
+{
+	builder_shard_t *shard;
+	vertex_t *vertex;
+
+	if (!builder || !str)
+		return (NULL);
+	shard = &builder->shards[vertex_index_hash(str) /
+				 ((size_t)-1 / GRAPH_BUILDER_SHARDS + 1)];
+
+	pthread_mutex_lock(&shard->lock);
+	vertex = vertex_index_find(&shard->index, str);
+	if (!vertex)
+	{
+		vertex = calloc(1, sizeof(vertex_t));
+		if (vertex)
+			vertex->content = strdup(str);
+		if (vertex && (!vertex->content ||
+			       !vertex_index_insert(&shard->index, vertex)))
+		{
+			free(vertex->content);
+			free(vertex);
+			vertex = NULL;
+		}
+		if (vertex)
+			vertex->index = __atomic_fetch_add(
+				&builder->nb_vertices, 1, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&shard->lock);
+
+	return (vertex);
+}
+
+
+
+/**
+ * builder_push_edge - program that pushes an edge on the edge list of
+ * a vertex, without locking
+ *
+ * the edge is pushed at the head of the list with a compare-and-swap,
+ * retried while other threads push edges on the same vertex
+ *
+ * @src_vertex: the vertex the edge leaves
+ * @edge: the edge, whose destination is already set
+ *
+ * Return: nothing (void)
+ */
+
+void builder_push_edge(vertex_t *src_vertex, edge_t *edge)
+{
+	edge->next = __atomic_load_n(&src_vertex->edges, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&src_vertex->edges, &edge->next,
+					    edge, 1, __ATOMIC_RELEASE,
+					    __ATOMIC_RELAXED))
+		;
+	__atomic_fetch_add(&src_vertex->nb_edges, 1, __ATOMIC_RELAXED);
+}
+
+
+
+/**
+ * graph_builder_add_edge - program that adds an edge between two vertices
+ * of a graph builder, safely from any thread
+ *
+ * the vertices are created if they do not exist yet; as in graph_add_edge,
+ * a vertex cannot be linked to itself, and the edges are allocated with
+ * graph_alloc and graph_edge_size for the graph the builder turns into,
+ * which has neither arena nor counters, so this is a plain malloc that
+ * is safe from any thread
+ *
+ * @builder: the builder
+ * @src: the content of the source vertex of the edge
+ * @dest: the content of the destination vertex of the edge
+ * @type: UNIDIRECTIONAL or BIDIRECTIONAL
+ *
+ * Return: 1 on success, 0 on failure, including when @src and @dest are
+ * the same vertex
+ */
+
+int graph_builder_add_edge(graph_builder_t *builder, const char *src,
+			   const char *dest, edge_type_t type)
+{
+	vertex_t *src_vertex, *dest_vertex;
+	edge_t *edge, *back = NULL;
+	size_t size;
+
+	if (!builder || !src || !dest || !strcmp(src, dest) ||
+	    (type != UNIDIRECTIONAL && type != BIDIRECTIONAL))
+		return (0);
+	src_vertex = graph_builder_add_vertex(builder, src);
+	dest_vertex = graph_builder_add_vertex(builder, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+
+	size = graph_edge_size(builder->graph);
+	edge = graph_alloc(builder->graph, size);
+	if (edge && type == BIDIRECTIONAL)
+		back = graph_alloc(builder->graph, size);
+	if (!edge || (type == BIDIRECTIONAL && !back))
+	{
+		if (edge)
+			graph_free(builder->graph, edge);
+		return (0);
+	}
+	memset(edge, 0, size);
+	if (back)
+		memset(back, 0, size);
+
+	edge->dest = dest_vertex;
+	builder_push_edge(src_vertex, edge);
+	if (back)
+	{
+		back->dest = src_vertex;
+		builder_push_edge(dest_vertex, back);
+	}
+	return (1);
+}
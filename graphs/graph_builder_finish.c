@@ -0,0 +1,185 @@
+#include "graphs.h"
+
+/**
+ * builder_free_shards - program that releases the shards of a graph
+ * builder
+ *
+ * the vertices stored in the shards are not freed
+ *
+ * @builder: the builder
+ * @nb_shards: the number of shards to release, from the first one
+ *
+ * Return: nothing (void)
+ */
+
+void builder_free_shards(graph_builder_t *builder, size_t nb_shards)
+{
+	size_t i;
+
+	for (i = 0; i < nb_shards; i++)
+	{
+		pthread_mutex_destroy(&builder->shards[i].lock);
+		vertex_index_clear(&builder->shards[i].index);
+	}
+}
+
+
+
+/**
+ * builder_reverse_edges - program that puts back the edges of a vertex
+ * of a graph builder in the order they were pushed
+ *
+ * @vertex: the vertex, whose edges list was built by pushing at its head
+ *
+ * Return: nothing (void)
+ */
+
+void builder_reverse_edges(vertex_t *vertex)
+{
+	edge_t *edge = vertex->edges, *prev = NULL, *next;
+
+	vertex->edges_tail = edge;
+	for (; edge; edge = next)
+	{
+		next = edge->next;
+		edge->next = prev;
+		prev = edge;
+	}
+	vertex->edges = prev;
+}
+
+
+
+/**
+ * builder_collect - program that moves the vertices of a graph builder
+ * into a graph
+ *
+ * the vertices are stored in the table of the graph by index and linked in
+ * the same order, and their contents are inserted in the hash index of
+ * the graph, which must already be large enough to hold them all
+ *
+ * @builder: the builder
+ * @graph: an empty graph, whose vertex table can hold all the vertices
+ *
+ * Return: nothing (void)
+ */
+
+void builder_collect(graph_builder_t *builder, graph_t *graph)
+{
+	vertex_index_t *index;
+	vertex_t *vertex;
+	size_t i, j, n = builder->nb_vertices;
+
+	for (i = 0; i < GRAPH_BUILDER_SHARDS; i++)
+	{
+		index = &builder->shards[i].index;
+		for (j = 0; j < index->capacity; j++)
+		{
+			vertex = index->slots[j].vertex;
+			if (vertex)
+				graph->vertex_table[vertex->index] = vertex;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		vertex = graph->vertex_table[i];
+		vertex->prev = i ? graph->vertex_table[i - 1] : NULL;
+		vertex->next = (i + 1 < n) ? graph->vertex_table[i + 1] : NULL;
+		builder_reverse_edges(vertex);
+		vertex_index_insert(&graph->lookup, vertex);
+	}
+	graph->vertices = n ? graph->vertex_table[0] : NULL;
+	graph->vertices_tail = n ? graph->vertex_table[n - 1] : NULL;
+	graph->nb_vertices = n;
+}
+
+
+
+/**
+ * graph_builder_finish - program that turns a graph builder into a graph
+ *
+ * it must be called once all the threads are done inserting; the vertices
+ * and edges are handed over to an ordinary graph without being copied,
+ * and every edge list is put back in the order its edges were pushed
+ *
+ * @builder: the builder, which is freed on success
+ *
+ * Return: a pointer to the graph, or NULL on failure, in which case the
+ * builder is left untouched and must be freed with graph_builder_delete
+ */
+
+graph_t *graph_builder_finish(graph_builder_t *builder)
+{
+	graph_t *graph;
+	size_t n;
+	int ok;
+
+	if (!builder)
+		return (NULL);
+	n = builder->nb_vertices;
+	graph = builder->graph;
+	graph->vertex_table = malloc((n + 1) * sizeof(vertex_t *));
+	ok = graph->vertex_table != NULL;
+	while (ok && (n + 1) * 10 > graph->lookup.capacity * 7)
+		ok = vertex_index_grow(&graph->lookup);
+	if (!ok)
+	{
+		free(graph->vertex_table);
+		graph->vertex_table = NULL;
+		return (NULL);
+	}
+
+	graph->table_capacity = n + 1;
+	builder_collect(builder, graph);
+	builder_free_shards(builder, GRAPH_BUILDER_SHARDS);
+	free(builder);
+	return (graph);
+}
+
+
+
+/**
+ * graph_builder_delete - program that frees a graph builder, with all
+ * the vertices and edges inserted in it
+ *
+ * it must be called on a builder that is abandoned, or whose
+ * graph_builder_finish failed, once all the threads are done inserting;
+ * a builder turned into a graph by graph_builder_finish is already freed
+ *
+ * @builder: a pointer to the builder to be deleted
+ *
+ * Return: nothing (void)
+ */
+
+void graph_builder_delete(graph_builder_t *builder)
+{
+	vertex_index_t *index;
+	vertex_t *vertex;
+	edge_t *edge, *next;
+	size_t i, j;
+
+	if (!builder)
+		return;
+
+	for (i = 0; i < GRAPH_BUILDER_SHARDS; i++)
+	{
+		index = &builder->shards[i].index;
+		for (j = 0; j < index->capacity; j++)
+		{
+			vertex = index->slots[j].vertex;
+			if (!vertex)
+				continue;
+			for (edge = vertex->edges; edge; edge = next)
+			{
+				next = edge->next;
+				graph_free(builder->graph, edge);
+			}
+			free(vertex->content);
+			free(vertex);
+		}
+	}
+	builder_free_shards(builder, GRAPH_BUILDER_SHARDS);
+	graph_delete(builder->graph);
+	free(builder);
+}
@@ -0,0 +1,128 @@
+#include "graphs.h"
+
+/**
+ * components_find - program that finds the root of a vertex in
+ * a union-find forest
+ *
+ * path halving makes every other vertex of the walked path point to its
+ * grandparent, which keeps the trees shallow without a second pass
+ *
+ * @parent: the union-find forest, indexed by vertex index
+ * @v: the index of the vertex
+ *
+ * Return: the index of the root of the tree of @v
+ */
+
+size_t components_find(size_t *parent, size_t v)
+{
+	while (parent[v] != v)
+	{
+		parent[v] = parent[parent[v]];
+		v = parent[v];
+	}
+
+	return (v);
+}
+
+
+
+/**
+ * components_union - program that merges the trees of two vertices in
+ * a union-find forest
+ *
+ * the root of higher index is linked under the root of lower index, so
+ * every vertex points to a vertex of lower or equal index and the root of
+ * a tree is always the vertex of lowest index of its component
+ *
+ * @parent: the union-find forest, indexed by vertex index
+ * @a: the index of the first vertex
+ * @b: the index of the second vertex
+ *
+ * Return: nothing (void)
+ */
+
+void components_union(size_t *parent, size_t a, size_t b)
+{
+	a = components_find(parent, a);
+	b = components_find(parent, b);
+	if (a < b)
+		parent[b] = a;
+	else if (b < a)
+		parent[a] = b;
+}
+
+
+
+/**
+ * components_label - program that turns a union-find forest into
+ * an array of component labels, in place
+ *
+ * the vertices are scanned by increasing index: a root opens the next
+ * component, any other vertex points to a vertex of lower index of the
+ * same component, which has already been given its label
+ *
+ * @parent: the union-find forest, replaced with the component of each
+ * vertex, numbered from 0 by increasing lowest vertex index
+ * @nb_vertices: the number of vertices in @parent
+ *
+ * Return: the number of components
+ */
+
+size_t components_label(size_t *parent, size_t nb_vertices)
+{
+	size_t v, nb_components = 0;
+
+	for (v = 0; v < nb_vertices; v++)
+	{
+		if (parent[v] == v)
+			parent[v] = nb_components++;
+		else
+			parent[v] = parent[parent[v]];
+	}
+
+	return (nb_components);
+}
+
+
+
+/**
+ * graph_weak_components - program that labels the weakly connected
+ * components of a graph
+ *
+ * every edge merges the components of its two ends in a union-find forest,
+ * regardless of its direction, so the whole labeling costs a single pass
+ * over the edges instead of one traversal per vertex
+ *
+ * @graph: the graph to label
+ * @nb_components: a pointer to store the number of components, or NULL
+ *
+ * Return: an array of nb_vertices component labels indexed by vertex index,
+ * numbered from 0 by increasing lowest vertex index, or NULL on failure;
+ * it must be freed by the caller
+ */
+
+size_t *graph_weak_components(const graph_t *graph, size_t *nb_components)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t *parent, v, count;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+
+	parent = malloc(graph->nb_vertices * sizeof(size_t));
+	if (!parent)
+		return (NULL);
+	for (v = 0; v < graph->nb_vertices; v++)
+		parent[v] = v;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (edge = vertex->edges; edge; edge = edge->next)
+			components_union(parent, vertex->index,
+					 edge->dest->index);
+
+	count = components_label(parent, graph->nb_vertices);
+	if (nb_components)
+		*nb_components = count;
+	return (parent);
+}
@@ -0,0 +1,174 @@
+#include "graphs.h"
+
+/**
+ * components_find_shared - program that finds the root of a vertex in
+ * a union-find forest shared between threads
+ *
+ * the parents are read and halved with atomic operations; halving only
+ * ever replaces a parent with one of its ancestors, so a concurrent
+ * link can never be undone
+ *
+ * @parent: the shared union-find forest
+ * @v: the index of the vertex
+ *
+ * Return: the index of the root of the tree of @v at the time of the call
+ */
+
+size_t components_find_shared(size_t *parent, size_t v)
+{
+	size_t p, gp;
+
+	while ((p = __atomic_load_n(&parent[v], __ATOMIC_RELAXED)) != v)
+	{
+		gp = __atomic_load_n(&parent[p], __ATOMIC_RELAXED);
+		if (gp != p)
+			__atomic_compare_exchange_n(&parent[v], &p, gp, 0,
+						    __ATOMIC_RELAXED,
+						    __ATOMIC_RELAXED);
+		v = gp;
+	}
+
+	return (v);
+}
+
+
+
+/**
+ * components_union_shared - program that merges the trees of two vertices
+ * in a union-find forest shared between threads, without locking
+ *
+ * the root of higher index is linked under the root of lower index with
+ * a compare-and-swap, which fails if another thread linked it first, in
+ * which case the roots are looked up again
+ *
+ * @parent: the shared union-find forest
+ * @a: the index of the first vertex
+ * @b: the index of the second vertex
+ *
+ * Return: nothing (void)
+ */
+
+void components_union_shared(size_t *parent, size_t a, size_t b)
+{
+	size_t tmp;
+
+	for (;;)
+	{
+		a = components_find_shared(parent, a);
+		b = components_find_shared(parent, b);
+		if (a == b)
+			return;
+		if (a < b)
+		{
+			tmp = a;
+			a = b;
+			b = tmp;
+		}
+		tmp = a;
+		if (__atomic_compare_exchange_n(&parent[a], &tmp, b, 0,
+						__ATOMIC_RELAXED,
+						__ATOMIC_RELAXED))
+			return;
+	}
+}
+
+
+
+/**
+ * parallel_components_worker - program that runs the share of a thread in
+ * a multithreaded weakly connected components labeling
+ *
+ * the thread claims chunks of vertices until none is left, and merges
+ * the ends of every edge leaving them
+ *
+ * @arg: a pointer to the shared state of the labeling
+ *
+ * Return: NULL
+ */
+
+void *parallel_components_worker(void *arg)
+{
+	parallel_components_t *pc = arg;
+	const graph_csr_t *csr = pc->csr;
+	size_t start, end, i;
+
+	while ((start = __atomic_fetch_add(&pc->cursor, PARALLEL_BFS_CHUNK,
+					   __ATOMIC_RELAXED)) <
+	       csr->nb_vertices)
+	{
+		end = start + PARALLEL_BFS_CHUNK;
+		if (end > csr->nb_vertices)
+			end = csr->nb_vertices;
+		for (; start < end; start++)
+			for (i = csr->offsets[start];
+			     i < csr->offsets[start + 1]; i++)
+				components_union_shared(pc->parent, start,
+							csr->targets[i]);
+	}
+
+	return (NULL);
+}
+
+
+
+/**
+ * graph_csr_weak_components_parallel - program that labels the weakly
+ * connected components of a CSR snapshot on several threads
+ *
+ * the edges are shared between the threads, which merge their ends in
+ * a single lock-free union-find forest; once all the threads are done,
+ * the forest is turned into labels as in graph_weak_components, so the
+ * result does not depend on the number of threads or their scheduling
+ *
+ * @csr: the snapshot to label, it must not be modified meanwhile
+ * @nb_threads: the number of threads to use, 0 for one per online CPU
+ * @nb_components: a pointer to store the number of components, or NULL
+ *
+ * Return: an array of nb_vertices component labels indexed by vertex index,
+ * numbered from 0 by increasing lowest vertex index, or NULL on failure;
+ * it must be freed by the caller
+ */
+
+size_t *graph_csr_weak_components_parallel(const graph_csr_t *csr,
+					   size_t nb_threads,
+					   size_t *nb_components)
+{
+	parallel_components_t pc;
+	pthread_t *threads;
+	size_t created = 0, v, count;
+	long cpus;
+
+	if (!csr || !csr->nb_vertices)
+		return (NULL);
+	if (!nb_threads)
+	{
+		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		nb_threads = (cpus > 0) ? (size_t)cpus : 1;
+	}
+	threads = malloc(nb_threads * sizeof(pthread_t));
+	pc.parent = malloc(csr->nb_vertices * sizeof(size_t));
+	if (!threads || !pc.parent)
+	{
+		free(threads);
+		free(pc.parent);
+		return (NULL);
+	}
+	pc.csr = csr;
+	pc.cursor = 0;
+	for (v = 0; v < csr->nb_vertices; v++)
+		pc.parent[v] = v;
+
+	while (created + 1 < nb_threads &&
+	       !pthread_create(&threads[created], NULL,
+			       parallel_components_worker, &pc))
+		created++;
+	parallel_components_worker(&pc);
+	for (v = 0; v < created; v++)
+		pthread_join(threads[v], NULL);
+	free(threads);
+
+	count = components_label(pc.parent, csr->nb_vertices);
+	if (nb_components)
+		*nb_components = count;
+	return (pc.parent);
+}
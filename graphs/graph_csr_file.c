@@ -0,0 +1,210 @@
+#include "graphs.h"
+
+/**
+ * graph_csr_save - program that writes a CSR snapshot to a binary file
+ *
+ * the file holds a graph_file_header_t followed by the arrays of the
+ * snapshot exactly as they are laid out in memory, so graph_csr_load can
+ * map it and use it in place;
+ * neither the reverse adjacency nor the edge weights, if any, are saved:
+ * a loaded snapshot is always unweighted
+ *
+ * @csr: the snapshot to save
+ * @path: the path of the file to create or overwrite
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_csr_save(const graph_csr_t *csr, const char *path)
+{
+	graph_file_header_t header;
+	size_t n, m;
+	FILE *file;
+	int ok;
+
+	if (!csr || !path)
+		return (0);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(header.magic));
+	header.version = GRAPH_FILE_VERSION;
+	header.byte_order = GRAPH_FILE_BYTE_ORDER;
+	header.word_size = sizeof(size_t);
+	header.nb_vertices = n = csr->nb_vertices;
+	header.nb_edges = m = csr->nb_edges;
+	header.strings_size = csr->strings_size;
+
+	file = fopen(path, "wb");
+	if (!file)
+		return (0);
+	ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(csr->offsets, sizeof(size_t), n + 1, file) == n + 1 &&
+		fwrite(csr->targets, sizeof(size_t), m, file) == m &&
+		fwrite(csr->contents, sizeof(size_t), n, file) == n &&
+		fwrite(csr->strings, 1, csr->strings_size, file) ==
+		csr->strings_size;
+	if (fclose(file))
+		ok = 0;
+
+	return (ok);
+}
+
+
+
+/**
+ * graph_save - program that writes a graph to a binary file
+ *
+ * @graph: the graph to save
+ * @path: the path of the file to create or overwrite
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_save(const graph_t *graph, const char *path)
+{
+	graph_csr_t *csr;
+	int ok;
+
+	csr = graph_freeze(graph);
+	if (!csr)
+		return (0);
+
+	ok = graph_csr_save(csr, path);
+	graph_csr_delete(csr);
+	return (ok);
+}
+
+
+
+/**
+ * graph_file_check - program that validates the header of a binary
+ * graph file against the size of the file
+ *
+ * only the header and the total size are checked here, the contents of
+ * the arrays are checked by graph_csr_check once they are mapped
+ *
+ * @header: the header read from the file
+ * @file_size: the size of the file, in bytes
+ *
+ * Return: 1 if the file can be used on this machine, 0 otherwise
+ */
+
+int graph_file_check(const graph_file_header_t *header, size_t file_size)
+{
+	size_t words;
+
+	if (memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(header->magic)) ||
+	    header->version != GRAPH_FILE_VERSION ||
+	    header->byte_order != GRAPH_FILE_BYTE_ORDER ||
+	    header->word_size != sizeof(size_t))
+		return (0);
+
+	if (header->nb_vertices > file_size || header->nb_edges > file_size ||
+	    header->strings_size > file_size)
+		return (0);
+
+	words = 2 * header->nb_vertices + 1 + header->nb_edges;
+	return (file_size == sizeof(graph_file_header_t) +
+		words * sizeof(size_t) + header->strings_size);
+}
+
+
+
+/**
+ * graph_csr_check - program that validates the arrays of a snapshot
+ * mapped from a binary graph file
+ *
+ * the offsets must start at 0, never decrease and end at the number of
+ * edges, every target and every content offset must be in range, and the
+ * string table must end with a null byte; this single pass over the
+ * arrays keeps a corrupt file from making the traversals read out of
+ * bounds
+ *
+ * @csr: the snapshot to check
+ *
+ * Return: 1 if the snapshot is consistent, 0 otherwise
+ */
+
+int graph_csr_check(const graph_csr_t *csr)
+{
+	size_t i;
+
+	if (csr->offsets[0] || csr->offsets[csr->nb_vertices] != csr->nb_edges)
+		return (0);
+	for (i = 0; i < csr->nb_vertices; i++)
+	{
+		if (csr->offsets[i] > csr->offsets[i + 1] ||
+		    csr->contents[i] >= csr->strings_size)
+			return (0);
+	}
+	for (i = 0; i < csr->nb_edges; i++)
+	{
+		if (csr->targets[i] >= csr->nb_vertices)
+			return (0);
+	}
+
+	return (!csr->strings_size ||
+		csr->strings[csr->strings_size - 1] == '\0');
+}
+
+
+
+/**
+ * graph_csr_load - program that loads a binary graph file written by
+ * graph_csr_save or graph_save
+ *
+ * the file is mapped read-only and the arrays of the returned snapshot
+ * point straight into the mapping: nothing is copied and no memory is
+ * allocated per vertex or per edge, pages are only read from disk when
+ * the traversals touch them;
+ * the header and arrays are validated (see graph_file_check and
+ * graph_csr_check), which costs one pass over the offsets and targets;
+ * the snapshot must be released with graph_csr_delete, which unmaps it
+ *
+ * @path: the path of the file to load
+ *
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+
+graph_csr_t *graph_csr_load(const char *path)
+{
+	const graph_file_header_t *header;
+	graph_csr_t *csr;
+	struct stat st;
+	int fd;
+
+	fd = path ? open(path, O_RDONLY) : -1;
+	if (fd == -1)
+		return (NULL);
+	if (fstat(fd, &st) == -1 ||
+	    st.st_size < (off_t)sizeof(graph_file_header_t))
+	{
+		close(fd);
+		return (NULL);
+	}
+	header = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (header == MAP_FAILED)
+		return (NULL);
+
+	csr = calloc(1, sizeof(graph_csr_t));
+	if (!csr || !graph_file_check(header, st.st_size))
+	{
+		free(csr);
+		munmap((void *)header, st.st_size);
+		return (NULL);
+	}
+	csr->mapping = (void *)header;
+	csr->mapping_size = st.st_size;
+	csr->nb_vertices = header->nb_vertices;
+	csr->nb_edges = header->nb_edges;
+	csr->strings_size = header->strings_size;
+	csr->offsets = (size_t *)(header + 1);
+	csr->targets = csr->offsets + csr->nb_vertices + 1;
+	csr->contents = csr->targets + csr->nb_edges;
+	csr->strings = (char *)(csr->contents + csr->nb_vertices);
+	if (graph_csr_check(csr))
+		return (csr);
+	graph_csr_delete(csr);
+	return (NULL);
+}
@@ -0,0 +1,176 @@
+#include "graphs.h"
+
+/**
+ * bfs_frontier_init - program that allocates the state of
+ * a direction-optimizing breadth-first traversal
+ *
+ * @frontier: a pointer to the state to initialize
+ * @nb_vertices: the number of vertices of the traversed snapshot
+ *
+ * Return: 1 on success, 0 if memory allocation fails, in which case
+ * nothing is left allocated
+ */
+
+int bfs_frontier_init(bfs_frontier_t *frontier, size_t nb_vertices)
+{
+	frontier->head = 0;
+	frontier->tail = 0;
+	frontier->queue = malloc(nb_vertices * sizeof(size_t));
+	frontier->visited = calloc(BITSET_WORDS(nb_vertices),
+				   sizeof(unsigned long));
+	frontier->current = calloc(BITSET_WORDS(nb_vertices),
+				   sizeof(unsigned long));
+	if (frontier->queue && frontier->visited && frontier->current)
+		return (1);
+
+	free(frontier->queue);
+	free(frontier->visited);
+	free(frontier->current);
+	return (0);
+}
+
+
+
+/**
+ * bfs_top_down_step - program that expands the current level of
+ * a breadth-first traversal from the frontier
+ *
+ * every edge leaving a vertex of the current level is checked, and its
+ * destination is appended to the next level if it was not discovered yet
+ *
+ * @csr: the traversed snapshot
+ * @frontier: the state of the traversal
+ * @end: the position in the queue of the end of the current level
+ *
+ * Return: nothing (void)
+ */
+
+void bfs_top_down_step(const graph_csr_t *csr, bfs_frontier_t *frontier,
+		       size_t end)
+{
+	size_t i, j, v, dest;
+
+	for (i = frontier->head; i < end; i++)
+	{
+		v = frontier->queue[i];
+		for (j = csr->offsets[v]; j < csr->offsets[v + 1]; j++)
+		{
+			dest = csr->targets[j];
+			if (BITSET_TEST(frontier->visited, dest))
+				continue;
+			BITSET_SET(frontier->visited, dest);
+			frontier->queue[frontier->tail++] = dest;
+		}
+	}
+}
+
+
+
+/**
+ * bfs_bottom_up_step - program that expands the current level of
+ * a breadth-first traversal from the undiscovered vertices
+ *
+ * every undiscovered vertex looks for a vertex of the current level among
+ * the sources of its incoming edges, and stops at the first one it finds;
+ * when the frontier is large this checks far fewer edges than expanding
+ * it top-down, most of whose edges lead to already discovered vertices;
+ * words of the visited bitset that are full are skipped at once
+ *
+ * @csr: the traversed snapshot, with its reverse adjacency
+ * @frontier: the state of the traversal
+ * @end: the position in the queue of the end of the current level
+ *
+ * Return: nothing (void)
+ */
+
+void bfs_bottom_up_step(const graph_csr_t *csr, bfs_frontier_t *frontier,
+			size_t end)
+{
+	size_t i, v;
+
+	memset(frontier->current, 0,
+	       BITSET_WORDS(csr->nb_vertices) * sizeof(unsigned long));
+	for (i = frontier->head; i < end; i++)
+		BITSET_SET(frontier->current, frontier->queue[i]);
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		if (frontier->visited[v / BITSET_BITS] == ~0UL)
+		{
+			v |= BITSET_BITS - 1;
+			continue;
+		}
+		if (BITSET_TEST(frontier->visited, v))
+			continue;
+		for (i = csr->in_offsets[v]; i < csr->in_offsets[v + 1]; i++)
+		{
+			if (!BITSET_TEST(frontier->current, csr->in_sources[i]))
+				continue;
+			BITSET_SET(frontier->visited, v);
+			frontier->queue[frontier->tail++] = v;
+			break;
+		}
+	}
+}
+
+
+
+/**
+ * graph_csr_breadth_first_hybrid - program that performs
+ * a direction-optimizing breadth-first traversal of a CSR snapshot
+ *
+ * the traversal starts from the vertex of index 0 and hands every reachable
+ * vertex to @action with the same depth as graph_csr_breadth_first_traverse;
+ * each level is expanded either top-down or bottom-up, depending on how
+ * many edges leave the frontier compared with the edges leaving the
+ * unvisited vertices (see BFS_HYBRID_ALPHA and BFS_HYBRID_BETA);
+ * the vertices of a level expanded bottom-up are reported in index order;
+ * without a reverse adjacency every level is expanded top-down
+ *
+ * @csr: the snapshot to traverse
+ * @action: a function to be called on each vertex during traversal
+ *
+ * Return: the maximum depth reached during the traversal
+ */
+
+size_t graph_csr_breadth_first_hybrid(const graph_csr_t *csr, void (*action)
+				      (const graph_csr_t *csr, size_t v,
+				       size_t depth))
+{
+	bfs_frontier_t frontier;
+	size_t depth = 0, end, i, v, edges_left, frontier_edges;
+	int bottom_up = 0;
+
+	if (!csr || !action || !csr->nb_vertices ||
+	    !bfs_frontier_init(&frontier, csr->nb_vertices))
+		return (0);
+	BITSET_SET(frontier.visited, 0);
+	frontier.queue[frontier.tail++] = 0;
+	edges_left = csr->nb_edges;
+	for (; frontier.head < frontier.tail; depth++)
+	{
+		end = frontier.tail;
+		for (frontier_edges = 0, i = frontier.head; i < end; i++)
+		{
+			v = frontier.queue[i];
+			action(csr, v, depth);
+			frontier_edges += csr->offsets[v + 1] - csr->offsets[v];
+		}
+		edges_left -= frontier_edges;
+		if (!bottom_up && csr->in_offsets &&
+		    frontier_edges > edges_left / BFS_HYBRID_ALPHA)
+			bottom_up = 1;
+		else if (bottom_up && (end - frontier.head) * BFS_HYBRID_BETA <
+			 csr->nb_vertices)
+			bottom_up = 0;
+		if (bottom_up)
+			bfs_bottom_up_step(csr, &frontier, end);
+		else
+			bfs_top_down_step(csr, &frontier, end);
+		frontier.head = end;
+	}
+	free(frontier.queue);
+	free(frontier.visited);
+	free(frontier.current);
+	return (depth - 1);
+}
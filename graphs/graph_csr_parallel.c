@@ -0,0 +1,148 @@
+#include "graphs.h"
+
+/**
+ * parallel_bfs_flush - program that publishes the vertices a thread has
+ * discovered into the next level of a multithreaded traversal
+ *
+ * a single atomic addition reserves room for the whole buffer in the
+ * shared array, so threads only contend once per chunk of vertices
+ *
+ * @local: the private state of the thread
+ *
+ * Return: nothing (void)
+ */
+
+void parallel_bfs_flush(parallel_bfs_local_t *local)
+{
+	size_t pos;
+
+	if (!local->count)
+		return;
+
+	pos = __atomic_fetch_add(&local->bfs->next_size, local->count,
+				 __ATOMIC_RELAXED);
+	memcpy(local->bfs->next + pos, local->buffer,
+	       local->count * sizeof(size_t));
+	local->count = 0;
+}
+
+
+
+/**
+ * parallel_bfs_expand - program that discovers the unvisited neighbors
+ * of a vertex during a multithreaded traversal
+ *
+ * a vertex belongs to the thread whose atomic test-and-set flips its bit
+ * in the visited bitset, so each vertex gets its depth written and is
+ * published exactly once, whatever the number of threads;
+ * the bit is read before being set, which spares the atomic operation
+ * for the many edges leading to vertices discovered long ago
+ *
+ * @local: the private state of the thread
+ * @v: the index of the vertex to expand
+ *
+ * Return: nothing (void)
+ */
+
+void parallel_bfs_expand(parallel_bfs_local_t *local, size_t v)
+{
+	parallel_bfs_t *bfs = local->bfs;
+	unsigned long *word, mask;
+	size_t i, dest;
+
+	for (i = bfs->csr->offsets[v]; i < bfs->csr->offsets[v + 1]; i++)
+	{
+		dest = bfs->csr->targets[i];
+		word = &bfs->visited[dest / BITSET_BITS];
+		mask = 1UL << (dest % BITSET_BITS);
+		if (__atomic_load_n(word, __ATOMIC_RELAXED) & mask)
+			continue;
+		if (__atomic_fetch_or(word, mask, __ATOMIC_RELAXED) & mask)
+			continue;
+
+		bfs->depths[dest] = bfs->depth + 1;
+		local->buffer[local->count++] = dest;
+		if (local->count == PARALLEL_BFS_CHUNK)
+			parallel_bfs_flush(local);
+	}
+}
+
+
+
+/**
+ * parallel_bfs_advance - program that moves a multithreaded traversal
+ * on to its next level
+ *
+ * it must be called by a single thread, while all the others wait
+ * between the two barriers that separate two levels
+ *
+ * @bfs: the shared state of the traversal
+ *
+ * Return: nothing (void)
+ */
+
+void parallel_bfs_advance(parallel_bfs_t *bfs)
+{
+	size_t *swap;
+
+	swap = bfs->frontier;
+	bfs->frontier = bfs->next;
+	bfs->next = swap;
+	bfs->frontier_size = bfs->next_size;
+	bfs->next_size = 0;
+	bfs->cursor = 0;
+	bfs->depth++;
+}
+
+
+
+/**
+ * parallel_bfs_worker - program that runs the share of a thread in
+ * a multithreaded traversal
+ *
+ * for each level, the thread claims chunks of the frontier until none is
+ * left, publishes what it discovered, and meets the other threads at the
+ * barrier; the last thread to arrive moves the traversal to the next level
+ * and everyone meets again before reading the new frontier;
+ * the traversal ends when a level discovers no vertex
+ *
+ * @arg: a pointer to the shared state of the traversal
+ *
+ * Return: NULL
+ */
+
+void *parallel_bfs_worker(void *arg)
+{
+	parallel_bfs_local_t local;
+	parallel_bfs_t *bfs = arg;
+	size_t start, end;
+
+	local.bfs = bfs;
+	local.count = 0;
+	pthread_mutex_lock(&bfs->start_lock);
+	pthread_mutex_unlock(&bfs->start_lock);
+
+	while (bfs->frontier_size)
+	{
+		while ((start = __atomic_fetch_add(&bfs->cursor,
+						   PARALLEL_BFS_CHUNK,
+						   __ATOMIC_RELAXED)) <
+		       bfs->frontier_size)
+		{
+			end = start + PARALLEL_BFS_CHUNK;
+			if (end > bfs->frontier_size)
+				end = bfs->frontier_size;
+			while (start < end)
+				parallel_bfs_expand(&local,
+						    bfs->frontier[start++]);
+		}
+		parallel_bfs_flush(&local);
+
+		if (pthread_barrier_wait(&bfs->barrier) ==
+		    PTHREAD_BARRIER_SERIAL_THREAD)
+			parallel_bfs_advance(bfs);
+		pthread_barrier_wait(&bfs->barrier);
+	}
+
+	return (NULL);
+}
@@ -0,0 +1,155 @@
+#include "graphs.h"
+
+/**
+ * parallel_bfs_init - program that allocates the shared state of
+ * a multithreaded traversal starting from the vertex of index 0
+ *
+ * @bfs: a pointer to the state to initialize
+ * @csr: the snapshot to traverse
+ *
+ * Return: 1 on success, 0 if memory allocation fails, in which case
+ * nothing is left allocated
+ */
+
+int parallel_bfs_init(parallel_bfs_t *bfs, const graph_csr_t *csr)
+{
+	size_t n = csr->nb_vertices;
+
+	bfs->csr = csr;
+	bfs->visited = calloc(BITSET_WORDS(n), sizeof(unsigned long));
+	bfs->depths = malloc(n * sizeof(size_t));
+	bfs->frontier = malloc(n * sizeof(size_t));
+	bfs->next = malloc(n * sizeof(size_t));
+	if (!bfs->visited || !bfs->depths || !bfs->frontier || !bfs->next ||
+	    pthread_mutex_init(&bfs->start_lock, NULL))
+	{
+		free(bfs->visited);
+		free(bfs->depths);
+		free(bfs->frontier);
+		free(bfs->next);
+		return (0);
+	}
+
+	memset(bfs->depths, 0xff, n * sizeof(size_t));
+	BITSET_SET(bfs->visited, 0);
+	bfs->depths[0] = 0;
+	bfs->frontier[0] = 0;
+	bfs->frontier_size = 1;
+	bfs->next_size = 0;
+	bfs->cursor = 0;
+	bfs->depth = 0;
+	return (1);
+}
+
+
+
+/**
+ * parallel_bfs_start - program that spawns the helper threads of
+ * a multithreaded traversal
+ *
+ * the barrier is sized for @nb_threads before any helper is spawned, and
+ * the helpers are held back by the start lock until it is resized with the
+ * number of threads actually created, if some of them could not be
+ * spawned; if the barrier cannot be set up, the frontier is emptied so
+ * that no thread ever waits on it
+ *
+ * @bfs: the shared state of the traversal
+ * @threads: an array to store the identifiers of the helper threads
+ * @nb_threads: the total number of threads, including the calling one
+ * @created: a pointer to store the number of helper threads created,
+ * which must be joined whether the barrier could be set up or not
+ *
+ * Return: 1 on success, 0 if the barrier could not be initialized
+ */
+
+int parallel_bfs_start(parallel_bfs_t *bfs, pthread_t *threads,
+		       size_t nb_threads, size_t *created)
+{
+	int ok;
+
+	*created = 0;
+	if (pthread_barrier_init(&bfs->barrier, NULL, nb_threads))
+	{
+		bfs->frontier_size = 0;
+		return (0);
+	}
+
+	pthread_mutex_lock(&bfs->start_lock);
+	while (*created + 1 < nb_threads &&
+	       !pthread_create(&threads[*created], NULL,
+			       parallel_bfs_worker, bfs))
+		(*created)++;
+	ok = 1;
+	if (*created + 1 < nb_threads)
+	{
+		pthread_barrier_destroy(&bfs->barrier);
+		ok = !pthread_barrier_init(&bfs->barrier, NULL, *created + 1);
+	}
+	if (!ok)
+		bfs->frontier_size = 0;
+	pthread_mutex_unlock(&bfs->start_lock);
+
+	return (ok);
+}
+
+
+
+/**
+ * graph_csr_parallel_bfs - program that performs a level-synchronous
+ * breadth-first traversal of a CSR snapshot on several threads
+ *
+ * the traversal starts from the vertex of index 0; the frontier of each
+ * level is shared between the threads, and the depth of every vertex is
+ * written to the returned array rather than reported through a callback,
+ * so no synchronization is required from the caller;
+ * the calling thread takes part in the traversal
+ *
+ * @csr: the snapshot to traverse, it must not be modified meanwhile
+ * @nb_threads: the number of threads to use, 0 for one per online CPU
+ *
+ * Return: an array of nb_vertices depths indexed by vertex index, in which
+ * unreachable vertices have the depth GRAPH_UNREACHED, or NULL on failure;
+ * the caller is responsible for freeing it
+ */
+
+size_t *graph_csr_parallel_bfs(const graph_csr_t *csr, size_t nb_threads)
+{
+	parallel_bfs_t bfs;
+	pthread_t *threads;
+	size_t created, i;
+	long cpus;
+	int ok;
+
+	if (!csr || !csr->nb_vertices)
+		return (NULL);
+	if (!nb_threads)
+	{
+		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		nb_threads = (cpus > 0) ? (size_t)cpus : 1;
+	}
+
+	threads = malloc(nb_threads * sizeof(pthread_t));
+	if (!threads || !parallel_bfs_init(&bfs, csr))
+	{
+		free(threads);
+		return (NULL);
+	}
+	ok = parallel_bfs_start(&bfs, threads, nb_threads, &created);
+	parallel_bfs_worker(&bfs);
+	for (i = 0; i < created; i++)
+		pthread_join(threads[i], NULL);
+
+	if (ok)
+		pthread_barrier_destroy(&bfs.barrier);
+	pthread_mutex_destroy(&bfs.start_lock);
+	free(bfs.visited);
+	free(bfs.frontier);
+	free(bfs.next);
+	free(threads);
+	if (!ok)
+	{
+		free(bfs.depths);
+		return (NULL);
+	}
+	return (bfs.depths);
+}
@@ -0,0 +1,50 @@
+#include "graphs.h"
+
+/**
+ * graph_csr_add_reverse - program that builds the reverse adjacency
+ * of a CSR snapshot
+ *
+ * the reverse adjacency lists, for each vertex, the vertices that have an
+ * edge leading to it, in the same compressed sparse row layout as the
+ * forward adjacency; it is what the bottom-up steps of
+ * graph_csr_breadth_first_hybrid scan
+ *
+ * @csr: the snapshot to extend, left untouched if it already has
+ * a reverse adjacency
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_csr_add_reverse(graph_csr_t *csr)
+{
+	size_t *in_offsets, *in_sources, v, i;
+
+	if (!csr)
+		return (0);
+	if (csr->in_offsets)
+		return (1);
+
+	in_offsets = calloc(csr->nb_vertices + 2, sizeof(size_t));
+	in_sources = malloc((csr->nb_edges + 1) * sizeof(size_t));
+	if (!in_offsets || !in_sources)
+	{
+		free(in_offsets);
+		free(in_sources);
+		return (0);
+	}
+
+/* Count the edges leading to each vertex two slots ahead of it */
+	for (i = 0; i < csr->nb_edges; i++)
+		in_offsets[csr->targets[i] + 2]++;
+	for (v = 2; v < csr->nb_vertices + 2; v++)
+		in_offsets[v] += in_offsets[v - 1];
+
+/* Fill the lists, shifting each offset one slot down as it is consumed */
+	for (v = 0; v < csr->nb_vertices; v++)
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+			in_sources[in_offsets[csr->targets[i] + 1]++] = v;
+
+	csr->in_offsets = in_offsets;
+	csr->in_sources = in_sources;
+	return (1);
+}
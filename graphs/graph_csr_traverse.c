@@ -0,0 +1,127 @@
+#include "graphs.h"
+
+/**
+ * graph_csr_depth_first_traverse - program that traverses a CSR snapshot
+ * using depth-first search
+ *
+ * this function visits the vertices reachable from the vertex of index 0
+ * in the same order, and with the same depths, as depth_first_traverse
+ * does on the original graph;
+ * the recursion is replaced by an explicit stack of frames, so the depth
+ * of a vertex is simply the height of the stack when it is discovered
+ *
+ * @csr: the snapshot to traverse
+ * @action: a function to perform an action on each vertex along with
+ * its depth
+ *
+ * Return: the maximum depth reached during traversal
+ */
+
+size_t graph_csr_depth_first_traverse(const graph_csr_t *csr, void (*action)
+				      (const graph_csr_t *csr, size_t v,
+				       size_t depth))
+{
+	unsigned long *visited;
+	csr_frame_t *stack, *frame;
+	size_t top = 1, dest, max_depth = 0;
+
+	if (!csr || !action || !csr->nb_vertices)
+		return (0);
+
+	visited = calloc(BITSET_WORDS(csr->nb_vertices), sizeof(unsigned long));
+	stack = malloc(csr->nb_vertices * sizeof(csr_frame_t));
+	if (!visited || !stack)
+	{
+		free(visited);
+		free(stack);
+		return (0);
+	}
+	BITSET_SET(visited, 0);
+	action(csr, 0, 0);
+	stack[0].vertex = 0;
+	stack[0].edge = csr->offsets[0];
+	while (top)
+	{
+		frame = &stack[top - 1];
+		if (frame->edge == csr->offsets[frame->vertex + 1])
+		{
+			top--;
+			continue;
+		}
+		dest = csr->targets[frame->edge++];
+		if (BITSET_TEST(visited, dest))
+			continue;
+		BITSET_SET(visited, dest);
+		action(csr, dest, top);
+		max_depth = (top > max_depth) ? top : max_depth;
+		stack[top].vertex = dest;
+		stack[top++].edge = csr->offsets[dest];
+	}
+
+	free(visited);
+	free(stack);
+	return (max_depth);
+}
+
+
+
+/**
+ * graph_csr_breadth_first_traverse - program that traverses a CSR
+ * snapshot using breadth-first search
+ *
+ * this function visits the vertices reachable from the vertex of index 0
+ * in the same order, and with the same depths, as breadth_first_traverse
+ * does on the original graph;
+ * every vertex is enqueued at most once, so the queue is a single array
+ * of nb_vertices indices, and the depth changes each time the head of the
+ * queue crosses the end of the current level
+ *
+ * @csr: the snapshot to traverse
+ * @action: a function to be called on each vertex during traversal
+ *
+ * Return: the maximum depth reached during the traversal
+ */
+
+size_t graph_csr_breadth_first_traverse(const graph_csr_t *csr, void (*action)
+					(const graph_csr_t *csr, size_t v,
+					 size_t depth))
+{
+	unsigned long *visited;
+	size_t *queue, head = 0, tail = 1, level_end = 1, depth = 0, v, i;
+
+	if (!csr || !action || !csr->nb_vertices)
+		return (0);
+
+	visited = calloc(BITSET_WORDS(csr->nb_vertices), sizeof(unsigned long));
+	queue = malloc(csr->nb_vertices * sizeof(size_t));
+	if (!visited || !queue)
+	{
+		free(visited);
+		free(queue);
+		return (0);
+	}
+
+	BITSET_SET(visited, 0);
+	queue[0] = 0;
+	while (head < tail)
+	{
+		if (head == level_end)
+		{
+			depth++;
+			level_end = tail;
+		}
+		v = queue[head++];
+		action(csr, v, depth);
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+		{
+			if (BITSET_TEST(visited, csr->targets[i]))
+				continue;
+			BITSET_SET(visited, csr->targets[i]);
+			queue[tail++] = csr->targets[i];
+		}
+	}
+
+	free(visited);
+	free(queue);
+	return (depth);
+}
@@ -0,0 +1,197 @@
+#include "graphs.h"
+
+/**
+ * dfs_engine_finish - program that finishes a vertex during a traversal
+ * of the depth-first traversal engine
+ *
+ * @dfs: the state of the traversal
+ * @vertex: the vertex whose edges have all been explored
+ * @depth: the depth of @vertex
+ *
+ * Return: 1 to carry on, 0 if the post-visit callback stopped the traversal
+ */
+
+int dfs_engine_finish(dfs_engine_t *dfs, const vertex_t *vertex,
+		      size_t depth)
+{
+	const dfs_visitor_t *visitor = dfs->visitor;
+
+	BITSET_SET(dfs->finished, vertex->index);
+	if (visitor->post &&
+	    visitor->post(vertex, depth, visitor->data) == DFS_STOP)
+		return (0);
+	return (1);
+}
+
+
+
+/**
+ * dfs_engine_discover - program that discovers a vertex during a traversal
+ * of the depth-first traversal engine
+ *
+ * the vertex is pushed on the stack to have its edges explored, unless
+ * the pre-visit callback prunes it, in which case it is finished at once
+ *
+ * @dfs: the state of the traversal
+ * @vertex: the undiscovered vertex
+ *
+ * Return: 1 to carry on, 0 if a callback stopped the traversal,
+ * -1 if memory allocation fails
+ */
+
+int dfs_engine_discover(dfs_engine_t *dfs, vertex_t *vertex)
+{
+	const dfs_visitor_t *visitor = dfs->visitor;
+	dfs_action_t action = DFS_CONTINUE;
+	size_t depth = dfs->stack.size;
+
+	dfs->order[vertex->index] = ++dfs->counter;
+	if (dfs->counters)
+		dfs->counters->vertices_visited++;
+	if (visitor->pre)
+		action = visitor->pre(vertex, depth, visitor->data);
+	if (action == DFS_STOP)
+		return (0);
+	if (action == DFS_PRUNE)
+		return (dfs_engine_finish(dfs, vertex, depth));
+
+	return (dfs_stack_push(&dfs->stack, vertex) ? 1 : -1);
+}
+
+
+
+/**
+ * dfs_engine_follow - program that explores the next edge of the vertex
+ * of a frame during a traversal of the depth-first traversal engine
+ *
+ * the edge is classified from the discovery ranks of its ends and whether
+ * its destination is finished, handed to the edge callback, and followed
+ * if it is a tree edge the callback did not prune
+ *
+ * @dfs: the state of the traversal
+ * @frame: the frame on top of the stack, which has an edge left
+ *
+ * Return: 1 to carry on, 0 if a callback stopped the traversal,
+ * -1 if memory allocation fails
+ */
+
+int dfs_engine_follow(dfs_engine_t *dfs, dfs_frame_t *frame)
+{
+	const dfs_visitor_t *visitor = dfs->visitor;
+	dfs_action_t action = DFS_CONTINUE;
+	dfs_edge_kind_t kind;
+	vertex_t *dest;
+
+	dest = frame->edge->dest;
+	frame->edge = frame->edge->next;
+	if (dfs->counters)
+		dfs->counters->edges_scanned++;
+	if (!dfs->order[dest->index])
+		kind = DFS_TREE_EDGE;
+	else if (!BITSET_TEST(dfs->finished, dest->index))
+		kind = DFS_BACK_EDGE;
+	else if (dfs->order[dest->index] > dfs->order[frame->vertex->index])
+		kind = DFS_FORWARD_EDGE;
+	else
+		kind = DFS_CROSS_EDGE;
+
+	if (visitor->edge)
+		action = visitor->edge(frame->vertex, dest, kind,
+				       visitor->data);
+	if (action == DFS_STOP)
+		return (0);
+	if (kind != DFS_TREE_EDGE || action == DFS_PRUNE)
+		return (1);
+	return (dfs_engine_discover(dfs, dest));
+}
+
+
+
+/**
+ * dfs_engine_run - program that grows one depth-first tree during
+ * a traversal of the depth-first traversal engine
+ *
+ * @dfs: the state of the traversal
+ * @root: the undiscovered vertex to start from
+ *
+ * Return: 1 once the tree is complete, 0 if a callback stopped the
+ * traversal, -1 if memory allocation fails
+ */
+
+int dfs_engine_run(dfs_engine_t *dfs, vertex_t *root)
+{
+	dfs_frame_t *frame;
+	int ret;
+
+	ret = dfs_engine_discover(dfs, root);
+	while (ret == 1 && dfs->stack.size)
+	{
+		frame = &dfs->stack.frames[dfs->stack.size - 1];
+		if (frame->edge)
+		{
+			ret = dfs_engine_follow(dfs, frame);
+			continue;
+		}
+		dfs->stack.size--;
+		ret = dfs_engine_finish(dfs, frame->vertex, dfs->stack.size);
+	}
+
+	return (ret);
+}
+
+
+
+/**
+ * graph_dfs - program that performs a depth-first traversal of a graph,
+ * reporting its progress to a set of callbacks
+ *
+ * every vertex is pre-visited when discovered and post-visited once all
+ * its edges are explored, and every explored edge is classified as a tree,
+ * back, forward or cross edge; the callbacks can prune the exploration of
+ * a vertex or of a tree edge, or stop the whole traversal;
+ * the traversal uses an explicit stack, so its depth is only bounded by
+ * the available memory; a back edge is met if and only if the traversed
+ * part of the graph has a cycle; the visited vertices and the explored
+ * edges are counted as they go in the profiling counters of the graph
+ *
+ * @graph: the graph to traverse
+ * @start: the vertex to start from, or NULL to traverse the whole graph,
+ * growing a new tree from each undiscovered vertex in the order of the
+ * adjacency linked list
+ * @visitor: the callbacks of the traversal
+ *
+ * Return: 1 if the traversal completed, 0 if a callback stopped it,
+ * -1 on failure
+ */
+
+int graph_dfs(const graph_t *graph, vertex_t *start,
+	      const dfs_visitor_t *visitor)
+{
+	dfs_engine_t dfs = {NULL, NULL, NULL, 0, {NULL, 0, 0, NULL}, NULL};
+	vertex_t *vertex;
+	int ret = 1;
+
+	if (!graph || !visitor)
+		return (-1);
+	dfs.visitor = visitor;
+	dfs.counters = graph->counters;
+	dfs.stack.counters = graph->counters;
+	GRAPH_COUNT(graph, allocations, 2);
+	dfs.order = calloc(graph->nb_vertices + 1, sizeof(size_t));
+	dfs.finished = calloc(BITSET_WORDS(graph->nb_vertices) + 1,
+			      sizeof(unsigned long));
+	if (!dfs.order || !dfs.finished)
+		ret = -1;
+
+	if (ret == 1 && start)
+		ret = dfs_engine_run(&dfs, start);
+	for (vertex = graph->vertices; ret == 1 && !start && vertex;
+	     vertex = vertex->next)
+		if (!dfs.order[vertex->index])
+			ret = dfs_engine_run(&dfs, vertex);
+
+	free(dfs.order);
+	free(dfs.finished);
+	free(dfs.stack.frames);
+	return (ret);
+}
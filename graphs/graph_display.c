@@ -6,7 +6,7 @@
  * @graph: pointer to the graph to display
  *
  * this function prints the contents of a graph in the form of
- * an adjacency list;
+ * an adjacency list, through a buffered writer (see graph_write);
  * tt prints each vertex's index, content, and its connected vertices (edges);
  * the format is as follows:
  * [vertex_index] vertex_content -> [connected_vertex_index]-> ...
@@ -20,41 +20,43 @@
 
 void graph_display(const graph_t *graph)
 {
-	vertex_t *current_vertex;
+	char buffer[GRAPH_WRITER_BUFFER];
+	graph_writer_t writer;
 
 /* Check if the graph is NULL */
 	if (!graph)
 		return;
 
-	printf("Number of vertices: %lu\n", graph->nb_vertices);
-
-/* Traverse through each vertex in the graph */
-	for (current_vertex = graph->vertices; current_vertex;
-	     current_vertex = current_vertex->next)
-	{
-		edge_t *current_edge;
-
-/* Print the vertex's index and content */
-		printf("[%lu] %s", current_vertex->index,
-		       current_vertex->content);
-
-/* Check if the vertex has any connected vertices (edges) */
-		if (current_vertex->edges)
-			printf(" ->");
-
-/* Traverse through each edge of the current vertex */
-		for (current_edge = current_vertex->edges; current_edge;
-		     current_edge = current_edge->next)
-		{
-			if (current_edge->dest)
-				printf("%lu", current_edge->dest->index);
-			else
-				printf("nil");
-
-			if (current_edge->next)
-				printf("->");
-		}
-
-		printf("\n");
-	}
+/* Gather the output in a local buffer, handed to stdout when full */
+	graph_writer_init(&writer, stdout, STDOUT_FILENO, buffer,
+			  sizeof(buffer));
+	graph_write(graph, &writer);
+	graph_writer_clear(&writer);
+}
+
+
+
+/**
+ * graph_csr_display - program that displays the contents of a CSR snapshot
+ *
+ * this function prints the snapshot in exactly the same format as
+ * graph_display prints the graph it was taken from
+ *
+ * @csr: pointer to the snapshot to display
+ *
+ * Return: Nothing (void)
+ */
+
+void graph_csr_display(const graph_csr_t *csr)
+{
+	char buffer[GRAPH_WRITER_BUFFER];
+	graph_writer_t writer;
+
+	if (!csr)
+		return;
+
+	graph_writer_init(&writer, stdout, STDOUT_FILENO, buffer,
+			  sizeof(buffer));
+	graph_csr_write(csr, &writer);
+	graph_writer_clear(&writer);
 }
@@ -0,0 +1,212 @@
+#include "graphs.h"
+
+/**
+ * edge_reader_parse_line - program that tokenizes one line of an edge list
+ *
+ * the first two whitespace-separated tokens of the line are the contents
+ * of the source and destination vertices; they are terminated in place,
+ * and any further token (a weight, for instance) is ignored;
+ * empty lines, lines with a single token, and comment lines starting
+ * with '#' or '%' (SNAP and Matrix Market style) are skipped; when the
+ * first line is a %%MatrixMarket banner, the first line that is not
+ * a comment, which holds the sizes of the matrix, is skipped too
+ *
+ * @reader: the state of the reader, receiving the edge in its batch
+ * @line: a pointer to the first character of the line
+ * @end: a pointer to the end of the line, which may be overwritten
+ *
+ * Return: 1 if an edge was added to the batch, 0 otherwise
+ */
+
+int edge_reader_parse_line(edge_reader_t *reader, char *line, char *end)
+{
+	char *tokens[2];
+	size_t n = 0;
+
+	if (!reader->header)
+		reader->header = (end - line >= 14 &&
+				  !strncmp(line, "%%MatrixMarket", 14)) ? 1 : 2;
+	while (n < 2)
+	{
+		while (line < end && isspace((unsigned char)*line))
+			line++;
+		if (line == end || (!n && (*line == '#' || *line == '%')))
+			break;
+		tokens[n++] = line;
+		while (line < end && !isspace((unsigned char)*line))
+			line++;
+		*line = '\0';
+		if (line < end)
+			line++;
+	}
+	if (n && reader->header == 1)
+	{
+		reader->header = 2;
+		return (0);
+	}
+	if (n < 2)
+		return (0);
+
+	reader->batch[reader->count].src = tokens[0];
+	reader->batch[reader->count].dest = tokens[1];
+	reader->batch[reader->count].type = reader->type;
+	reader->count++;
+	return (1);
+}
+
+
+
+/**
+ * edge_reader_flush - program that inserts the pending edges of a reader
+ * into a graph
+ *
+ * @graph: the graph being built
+ * @reader: the state of the reader
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int edge_reader_flush(graph_t *graph, edge_reader_t *reader)
+{
+	int ok;
+
+	ok = graph_add_edges_batch(graph, reader->batch, reader->count,
+				   GRAPH_BATCH_CREATE);
+	reader->count = 0;
+	return (ok);
+}
+
+
+
+/**
+ * edge_reader_parse - program that parses the complete lines held in
+ * the buffer of a reader
+ *
+ * the edges of the parsed lines are inserted by batches of at most
+ * EDGE_READER_BATCH edges, then the incomplete last line, if any,
+ * is moved to the start of the buffer to be completed by the next read
+ *
+ * @graph: the graph being built
+ * @reader: the state of the reader
+ * @eof: 1 if the end of the input was reached, in which case the last
+ * line is parsed even without a trailing newline
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int edge_reader_parse(graph_t *graph, edge_reader_t *reader, int eof)
+{
+	char *line = reader->buffer, *end, *newline;
+
+	end = reader->buffer + reader->len;
+	while (!eof && end > reader->buffer && end[-1] != '\n')
+		end--;
+
+	while (line < end)
+	{
+		newline = memchr(line, '\n', end - line);
+		if (!newline)
+			newline = end;
+		edge_reader_parse_line(reader, line, newline);
+		if (reader->count == EDGE_READER_BATCH &&
+		    !edge_reader_flush(graph, reader))
+			return (0);
+		line = newline + 1;
+	}
+	if (reader->count && !edge_reader_flush(graph, reader))
+		return (0);
+
+	reader->len -= end - reader->buffer;
+	memmove(reader->buffer, end, reader->len);
+	return (1);
+}
+
+
+
+/**
+ * graph_read_edge_list - program that adds the edges of a whitespace
+ * separated edge list to a graph
+ *
+ * the input is read with large read calls into a single buffer and
+ * tokenized in place, so no memory is allocated per line; vertices are
+ * created the first time they are mentioned, and edges are inserted with
+ * graph_add_edges_batch, so a line linking a vertex to itself makes the
+ * read fail; the buffer only grows for lines longer than it
+ *
+ * @graph: the graph to add the edges to
+ * @fd: the file descriptor to read the edge list from
+ * @type: the type of the edges (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_read_edge_list(graph_t *graph, int fd, edge_type_t type)
+{
+	edge_reader_t reader = {NULL, EDGE_READER_BUFFER, 0, NULL, 0, 0, 0};
+	ssize_t bytes = 1;
+	char *buffer;
+	int ok = 1;
+
+	if (!graph || fd < 0)
+		return (0);
+	reader.type = type;
+	reader.buffer = malloc(reader.size + 1);
+	reader.batch = malloc(EDGE_READER_BATCH * sizeof(edge_spec_t));
+	while (ok && bytes > 0 && reader.buffer && reader.batch)
+	{
+		if (reader.len == reader.size)
+		{
+			buffer = realloc(reader.buffer, reader.size * 2 + 1);
+			if (!buffer)
+				break;
+			reader.buffer = buffer;
+			reader.size *= 2;
+		}
+		bytes = read(fd, reader.buffer + reader.len,
+			     reader.size - reader.len);
+		if (bytes < 0 && errno == EINTR)
+		{
+			bytes = 1;
+			continue;
+		}
+		if (bytes >= 0)
+			reader.len += bytes;
+		ok = bytes >= 0 && edge_reader_parse(graph, &reader, !bytes);
+	}
+	free(reader.buffer);
+	free(reader.batch);
+	return (ok && !bytes);
+}
+
+
+
+/**
+ * graph_load_edge_list - program that builds a graph from an edge list file
+ *
+ * the graph is created with graph_create_arena, since a graph loaded from
+ * a file is usually large and deleted as a whole
+ *
+ * @path: the path of the edge list file
+ * @type: the type of the edges (UNIDIRECTIONAL or BIDIRECTIONAL)
+ *
+ * Return: a pointer to the graph, or NULL on failure
+ */
+
+graph_t *graph_load_edge_list(const char *path, edge_type_t type)
+{
+	graph_t *graph;
+	int fd;
+
+	fd = path ? open(path, O_RDONLY) : -1;
+	if (fd == -1)
+		return (NULL);
+
+	graph = graph_create_arena();
+	if (graph && !graph_read_edge_list(graph, fd, type))
+	{
+		graph_delete(graph);
+		graph = NULL;
+	}
+	close(fd);
+	return (graph);
+}
@@ -0,0 +1,130 @@
+#include "graphs.h"
+
+/**
+ * graph_clear_edges - program that drops the edge hash set of a graph
+ *
+ * the graph also stops rejecting duplicate edges, since it has no way
+ * left to find them quickly
+ *
+ * @graph: the graph whose edge set should be freed
+ *
+ * Return: nothing (void)
+ */
+
+void graph_clear_edges(graph_t *graph)
+{
+	if (!graph || !graph->edge_set)
+		return;
+
+	free(graph->edge_set->slots);
+	free(graph->edge_set);
+	graph->edge_set = NULL;
+	graph->unique_edges = 0;
+}
+
+
+
+/**
+ * graph_track_edges - program that makes a graph maintain a hash set
+ * of its edges
+ *
+ * the set is filled with the edges already in the graph, then kept up to
+ * date by every later insertion and removal; it costs one slot per pair
+ * of linked vertices (parallel edges share theirs), and lets
+ * graph_find_edge and graph_has_edge answer in constant expected time
+ * instead of walking the edge list of the source vertex
+ *
+ * @graph: the graph to extend, left untouched if it already tracks
+ * its edges
+ *
+ * Return: 1 on success, 0 on failure, in which case the graph is left
+ * without edge set
+ */
+
+int graph_track_edges(graph_t *graph)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t nb_edges = 0;
+
+	if (!graph)
+		return (0);
+	if (graph->edge_set)
+		return (1);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		nb_edges += vertex->nb_edges;
+	graph->edge_set = calloc(1, sizeof(edge_set_t));
+	if (!graph->edge_set || !edge_set_reserve(graph->edge_set, nb_edges))
+	{
+		graph_clear_edges(graph);
+		return (0);
+	}
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (edge = vertex->edges; edge; edge = edge->next)
+			edge_set_add(graph->edge_set, vertex, edge);
+	return (1);
+}
+
+
+
+/**
+ * graph_rehash_edges - program that refills the edge hash set of a graph
+ * after its vertices and edges have moved
+ *
+ * the set is keyed by the addresses of the vertices, so it has to be
+ * rebuilt by graph_relabel; the number of pairs is unchanged, hence the
+ * table is reused as it is
+ *
+ * @graph: the graph whose edge set should be rebuilt
+ *
+ * Return: nothing (void)
+ */
+
+void graph_rehash_edges(graph_t *graph)
+{
+	edge_set_t *set = graph->edge_set;
+	vertex_t *vertex;
+	edge_t *edge;
+
+	if (!set)
+		return;
+
+	memset(set->slots, 0, set->capacity * sizeof(edge_slot_t));
+	set->size = 0;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (edge = vertex->edges; edge; edge = edge->next)
+			edge_set_add(set, vertex, edge);
+}
+
+
+
+/**
+ * graph_set_unique_edges - program that switches a graph in or out of
+ * unique-edges mode
+ *
+ * in unique-edges mode, adding an edge that already exists leaves the
+ * graph unchanged and reports success (graph_add_weighted_edge keeps the
+ * weight of the existing edge too), and batches are deduplicated
+ * against the graph as well as against themselves; the mode relies on
+ * the edge hash set, which is built if the graph does not track it yet;
+ * parallel edges inserted before the mode was turned on are kept
+ *
+ * @graph: the graph to configure
+ * @unique: 1 to reject duplicate edges, 0 to accept them again (the edge
+ * set is kept in that case, see graph_clear_edges)
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_set_unique_edges(graph_t *graph, int unique)
+{
+	if (!graph)
+		return (0);
+
+	if (unique && !graph_track_edges(graph))
+		return (0);
+	graph->unique_edges = unique ? 1 : 0;
+	return (1);
+}
@@ -0,0 +1,130 @@
+#include "graphs.h"
+
+/**
+ * cycle_search_pre - program that pushes a discovered vertex on the path
+ * of a cycle search
+ *
+ * @v: the discovered vertex
+ * @depth: the depth of @v, unused
+ * @data: a pointer to the cycle_search_t state of the search
+ *
+ * Return: DFS_CONTINUE
+ */
+
+dfs_action_t cycle_search_pre(const vertex_t *v, size_t depth, void *data)
+{
+	cycle_search_t *search = data;
+
+	(void)depth;
+	search->path[search->size++] = v->index;
+	return (DFS_CONTINUE);
+}
+
+
+
+/**
+ * cycle_search_post - program that pops a finished vertex from the path
+ * of a cycle search
+ *
+ * @v: the finished vertex, unused
+ * @depth: the depth of @v, unused
+ * @data: a pointer to the cycle_search_t state of the search
+ *
+ * Return: DFS_CONTINUE
+ */
+
+dfs_action_t cycle_search_post(const vertex_t *v, size_t depth, void *data)
+{
+	cycle_search_t *search = data;
+
+	(void)v;
+	(void)depth;
+	search->size--;
+	return (DFS_CONTINUE);
+}
+
+
+
+/**
+ * cycle_search_edge - program that stops a cycle search at its first
+ * back edge
+ *
+ * a back edge leads to a vertex of the current path, so the part of the
+ * path from that vertex to the source of the edge is a cycle
+ *
+ * @src: the source of the edge
+ * @dest: the destination of the edge
+ * @kind: the class of the edge
+ * @data: a pointer to the cycle_search_t state of the search
+ *
+ * Return: DFS_STOP on a back edge, DFS_CONTINUE otherwise
+ */
+
+dfs_action_t cycle_search_edge(const vertex_t *src, const vertex_t *dest,
+			       dfs_edge_kind_t kind, void *data)
+{
+	cycle_search_t *search = data;
+
+	(void)src;
+	if (kind != DFS_BACK_EDGE)
+		return (DFS_CONTINUE);
+
+	search->start = search->size - 1;
+	while (search->path[search->start] != dest->index)
+		search->start--;
+	return (DFS_STOP);
+}
+
+
+
+/**
+ * graph_find_cycle - program that finds a cycle in a graph
+ *
+ * the graph is traversed with graph_dfs until the first back edge, which
+ * closes a cycle made of vertices of the current path; this explains why
+ * graph_topological_sort could not sort the whole graph
+ *
+ * @graph: the graph to search
+ * @length: a pointer to store the number of vertices of the cycle,
+ * 0 if the graph has no cycle
+ *
+ * Return: an array of the @length vertices of the cycle, each of them
+ * having an edge to the next one and the last one an edge to the first
+ * one, or NULL if there is no cycle or on failure; it must be freed by
+ * the caller
+ */
+
+vertex_t **graph_find_cycle(const graph_t *graph, size_t *length)
+{
+	cycle_search_t search = {NULL, 0, 0};
+	dfs_visitor_t visitor;
+	vertex_t **cycle = NULL;
+	size_t i, v;
+
+	if (length)
+		*length = 0;
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+	search.path = malloc(graph->nb_vertices * sizeof(size_t));
+	if (!search.path)
+		return (NULL);
+	visitor.pre = cycle_search_pre;
+	visitor.post = cycle_search_post;
+	visitor.edge = cycle_search_edge;
+	visitor.data = &search;
+
+	if (graph_dfs(graph, NULL, &visitor) == 0)
+	{
+		search.size -= search.start;
+		cycle = malloc(search.size * sizeof(vertex_t *));
+		for (i = 0; cycle && i < search.size; i++)
+		{
+			v = search.path[search.start + i];
+			cycle[i] = graph->vertex_table[v];
+		}
+		if (cycle && length)
+			*length = search.size;
+	}
+	free(search.path);
+	return (cycle);
+}
@@ -0,0 +1,171 @@
+#include "graphs.h"
+
+/**
+ * graph_freeze_rows - program that fills the offsets and targets arrays
+ * of a CSR snapshot from the adjacency linked list of a graph
+ *
+ * the number of edges of each vertex is first stored in the slot following
+ * its index, a prefix sum then turns these counts into offsets, and a
+ * second pass copies the destination indices of every edge list in order
+ *
+ * @graph: the graph to snapshot
+ * @csr: the snapshot to fill, its nb_vertices member must already be set
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int graph_freeze_rows(const graph_t *graph, graph_csr_t *csr)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t i, pos;
+
+	csr->offsets = calloc(csr->nb_vertices + 1, sizeof(size_t));
+	if (!csr->offsets)
+		return (0);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		csr->offsets[vertex->index + 1] = vertex->nb_edges;
+	for (i = 0; i < csr->nb_vertices; i++)
+		csr->offsets[i + 1] += csr->offsets[i];
+	csr->nb_edges = csr->offsets[csr->nb_vertices];
+
+	csr->targets = malloc((csr->nb_edges + 1) * sizeof(size_t));
+	if (!csr->targets)
+		return (0);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		pos = csr->offsets[vertex->index];
+		for (edge = vertex->edges; edge; edge = edge->next)
+			csr->targets[pos++] = edge->dest->index;
+	}
+
+	return (1);
+}
+
+
+
+/**
+ * graph_freeze_contents - program that interns the contents of the
+ * vertices of a graph into the string table of a CSR snapshot
+ *
+ * @graph: the graph to snapshot
+ * @csr: the snapshot to fill, its nb_vertices member must already be set
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int graph_freeze_contents(const graph_t *graph, graph_csr_t *csr)
+{
+	vertex_t *vertex;
+	size_t size = 0, len;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		size += strlen(vertex->content) + 1;
+
+	csr->contents = malloc((csr->nb_vertices + 1) * sizeof(size_t));
+	csr->strings = malloc(size + 1);
+	if (!csr->contents || !csr->strings)
+		return (0);
+
+	size = 0;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		len = strlen(vertex->content) + 1;
+		csr->contents[vertex->index] = size;
+		memcpy(csr->strings + size, vertex->content, len);
+		size += len;
+	}
+	csr->strings_size = size;
+
+	return (1);
+}
+
+
+
+/**
+ * graph_freeze - program that builds a compact, read-only snapshot
+ * of a graph in compressed sparse row layout
+ *
+ * the snapshot is independent from the graph: the graph can be modified
+ * or deleted afterwards without affecting it;
+ * traversing the snapshot only walks a few contiguous arrays, instead of
+ * chasing the pointers of the vertex and edge linked lists
+ *
+ * @graph: the graph to snapshot
+ *
+ * Return: a pointer to the snapshot, or NULL on failure
+ */
+
+graph_csr_t *graph_freeze(const graph_t *graph)
+{
+	graph_csr_t *csr;
+
+	if (!graph)
+		return (NULL);
+
+	csr = calloc(1, sizeof(graph_csr_t));
+	if (!csr)
+		return (NULL);
+	csr->nb_vertices = graph->nb_vertices;
+
+	if (!graph_freeze_rows(graph, csr) ||
+	    !graph_freeze_contents(graph, csr) ||
+	    !graph_freeze_weights(graph, csr))
+	{
+		graph_csr_delete(csr);
+		return (NULL);
+	}
+
+	return (csr);
+}
+
+
+
+/**
+ * graph_csr_content - program that retrieves the content of a vertex
+ * of a CSR snapshot
+ *
+ * @csr: the snapshot
+ * @vertex: the index of the vertex
+ *
+ * Return: the content string of the vertex
+ */
+
+const char *graph_csr_content(const graph_csr_t *csr, size_t vertex)
+{
+	return (csr->strings + csr->contents[vertex]);
+}
+
+
+
+/**
+ * graph_csr_delete - program that frees a CSR snapshot
+ *
+ * a snapshot loaded with graph_csr_load is unmapped rather than freed
+ *
+ * @csr: a pointer to the snapshot to be deleted
+ *
+ * Return: nothing (void)
+ */
+
+void graph_csr_delete(graph_csr_t *csr)
+{
+	if (!csr)
+		return;
+
+	if (csr->mapping)
+		munmap(csr->mapping, csr->mapping_size);
+	else
+	{
+		free(csr->offsets);
+		free(csr->targets);
+		free(csr->contents);
+		free(csr->strings);
+	}
+	free(csr->in_offsets);
+	free(csr->in_sources);
+	free(csr->weights);
+	free(csr);
+}
@@ -0,0 +1,125 @@
+#include "graphs.h"
+
+/**
+ * vertex_find_edge - program that walks the edge list of a vertex for
+ * the first edge leading to a given vertex
+ *
+ * @src_vertex: the vertex whose edge list is searched
+ * @dest_vertex: the destination of the edge
+ *
+ * Return: a pointer to the edge, or NULL if there is none
+ */
+
+edge_t *vertex_find_edge(const vertex_t *src_vertex,
+			 const vertex_t *dest_vertex)
+{
+	edge_t *edge;
+
+	for (edge = src_vertex->edges; edge; edge = edge->next)
+		if (edge->dest == dest_vertex)
+			return (edge);
+
+	return (NULL);
+}
+
+
+
+/**
+ * graph_find_edge - program that finds an edge between two vertices
+ * of a graph
+ *
+ * the edge hash set is probed if the graph tracks one, otherwise the
+ * edge list of @src_vertex is walked; with parallel edges, the edge
+ * returned is one of them, not necessarily the first one
+ *
+ * @graph: the graph the vertices belong to
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ *
+ * Return: a pointer to the edge, or NULL if there is none
+ */
+
+edge_t *graph_find_edge(const graph_t *graph, const vertex_t *src_vertex,
+			const vertex_t *dest_vertex)
+{
+	edge_slot_t *slot;
+
+	if (!graph->edge_set)
+		return (vertex_find_edge(src_vertex, dest_vertex));
+
+	slot = edge_set_find(graph->edge_set, src_vertex, dest_vertex);
+	return (slot ? slot->edge : NULL);
+}
+
+
+
+/**
+ * graph_has_edge - program that checks whether a graph has an edge
+ * between two vertices
+ *
+ * both vertices are found through the vertex hash index, so with an edge
+ * hash set (see graph_track_edges) the whole query takes constant
+ * expected time
+ *
+ * @graph: the graph to search
+ * @src: the content of the source vertex of the edge
+ * @dest: the content of the destination vertex of the edge
+ *
+ * Return: 1 if there is an edge from @src to @dest, 0 otherwise
+ */
+
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest)
+{
+	vertex_t *src_vertex, *dest_vertex;
+
+	if (!graph || !src || !dest)
+		return (0);
+
+	src_vertex = vertex_index_find(&graph->lookup, src);
+	dest_vertex = vertex_index_find(&graph->lookup, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+
+	return (graph_find_edge(graph, src_vertex, dest_vertex) != NULL);
+}
+
+
+
+/**
+ * graph_get_edge_weight - program that reads the weight of an edge between
+ * two vertices of a weighted graph
+ *
+ * unlike EDGE_WEIGHT, the weight type of the graph is checked first, so
+ * this is safe to call on any graph; with parallel edges, the weight is
+ * the one of the edge graph_find_edge returns
+ *
+ * @graph: the graph to search
+ * @src: the content of the source vertex of the edge
+ * @dest: the content of the destination vertex of the edge
+ * @weight: a pointer to store the weight of the edge
+ *
+ * Return: 1 if the graph is weighted and has an edge from @src to @dest,
+ * 0 otherwise
+ */
+
+int graph_get_edge_weight(const graph_t *graph, const char *src,
+			  const char *dest, graph_weight_t *weight)
+{
+	vertex_t *src_vertex, *dest_vertex;
+	edge_t *edge;
+
+	if (!graph || !src || !dest || !weight ||
+	    graph->weight_type == GRAPH_UNWEIGHTED)
+		return (0);
+
+	src_vertex = vertex_index_find(&graph->lookup, src);
+	dest_vertex = vertex_index_find(&graph->lookup, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+
+	edge = graph_find_edge(graph, src_vertex, dest_vertex);
+	if (!edge)
+		return (0);
+	*weight = EDGE_WEIGHT(edge);
+	return (1);
+}
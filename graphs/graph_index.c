@@ -0,0 +1,155 @@
+#include "graphs.h"
+
+/**
+ * vertex_index_hash - program that computes the hash of a vertex content
+ *
+ * this function uses the 64-bit FNV-1a hash, which is cheap to compute
+ * and spreads short, similar strings (city names, numeric ids, ...)
+ * well enough for linear probing
+ *
+ * @str: the string to hash
+ *
+ * Return: the hash of the string
+ */
+
+size_t vertex_index_hash(const char *str)
+{
+	unsigned long hash = 14695981039346656037UL;
+
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= 1099511628211UL;
+	}
+
+	return ((size_t)hash);
+}
+
+
+
+/**
+ * vertex_index_grow - program that doubles the capacity of a vertex index
+ *
+ * this function allocates a new table of slots, twice as large as the
+ * current one (or 16 slots for an empty index), and re-inserts every
+ * stored vertex using its cached hash, so no string is hashed again
+ *
+ * @index: a pointer to the index to grow
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int vertex_index_grow(vertex_index_t *index)
+{
+	vertex_slot_t *slots;
+	size_t capacity, i, j;
+
+	capacity = index->capacity ? index->capacity * 2 : 16;
+	slots = calloc(capacity, sizeof(vertex_slot_t));
+	if (!slots)
+		return (0);
+
+	for (i = 0; i < index->capacity; i++)
+	{
+		if (!index->slots[i].vertex)
+			continue;
+
+		j = index->slots[i].hash & (capacity - 1);
+		while (slots[j].vertex)
+			j = (j + 1) & (capacity - 1);
+		slots[j] = index->slots[i];
+	}
+
+	free(index->slots);
+	index->slots = slots;
+	index->capacity = capacity;
+	return (1);
+}
+
+
+
+/**
+ * vertex_index_insert - program that adds a vertex to a vertex index
+ *
+ * the table is grown beforehand so that its load factor never exceeds
+ * 70%, which keeps the probe sequences short;
+ * the caller is responsible for making sure the content of the vertex
+ * is not already stored in the index
+ *
+ * @index: a pointer to the index to add the vertex to
+ * @vertex: a pointer to the vertex to add
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int vertex_index_insert(vertex_index_t *index, vertex_t *vertex)
+{
+	size_t hash, i;
+
+	if ((index->size + 1) * 10 > index->capacity * 7 &&
+	    !vertex_index_grow(index))
+		return (0);
+
+	hash = vertex_index_hash(vertex->content);
+	i = hash & (index->capacity - 1);
+	while (index->slots[i].vertex)
+		i = (i + 1) & (index->capacity - 1);
+
+	index->slots[i].hash = hash;
+	index->slots[i].vertex = vertex;
+	index->size++;
+	return (1);
+}
+
+
+
+/**
+ * vertex_index_find - program that looks up a vertex by its content
+ *
+ * the cached hashes are compared first, so strcmp is only called
+ * on slots that are very likely to hold the searched vertex
+ *
+ * @index: a pointer to the index to search
+ * @str: the content of the vertex to look for
+ *
+ * Return: a pointer to the matching vertex, or NULL if there is none
+ */
+
+vertex_t *vertex_index_find(const vertex_index_t *index, const char *str)
+{
+	size_t hash, i;
+
+	if (!index->size)
+		return (NULL);
+
+	hash = vertex_index_hash(str);
+	for (i = hash & (index->capacity - 1); index->slots[i].vertex;
+	     i = (i + 1) & (index->capacity - 1))
+	{
+		if (index->slots[i].hash == hash &&
+		    strcmp(index->slots[i].vertex->content, str) == 0)
+			return (index->slots[i].vertex);
+	}
+
+	return (NULL);
+}
+
+
+
+/**
+ * vertex_index_clear - program that releases the table of a vertex index
+ *
+ * the vertices themselves are not freed, they are owned by the graph
+ *
+ * @index: a pointer to the index to clear
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_index_clear(vertex_index_t *index)
+{
+	free(index->slots);
+	index->slots = NULL;
+	index->capacity = 0;
+	index->size = 0;
+}
@@ -0,0 +1,44 @@
+#include "graphs.h"
+
+/**
+ * vertex_index_remove - program that removes a vertex from a vertex index
+ *
+ * the slot of the vertex is emptied with backward-shift deletion: the
+ * following slots of the probe run are moved back into the hole whenever
+ * their home slot allows it, so that no tombstone is left behind and later
+ * lookups stay as short as if the vertex had never been inserted
+ *
+ * @index: a pointer to the index to remove the vertex from
+ * @vertex: a pointer to the vertex to remove
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_index_remove(vertex_index_t *index, const vertex_t *vertex)
+{
+	size_t mask, hole, i, home;
+
+	if (!index->size)
+		return;
+
+	mask = index->capacity - 1;
+	hole = vertex_index_hash(vertex->content) & mask;
+	while (index->slots[hole].vertex && index->slots[hole].vertex != vertex)
+		hole = (hole + 1) & mask;
+	if (!index->slots[hole].vertex)
+		return;
+
+	for (i = (hole + 1) & mask; index->slots[i].vertex; i = (i + 1) & mask)
+	{
+		home = index->slots[i].hash & mask;
+/* Leave the slot alone if its home lies in (hole, i] */
+		if (((i - home) & mask) < ((i - hole) & mask))
+			continue;
+		index->slots[hole] = index->slots[i];
+		hole = i;
+	}
+
+	index->slots[hole].vertex = NULL;
+	index->slots[hole].hash = 0;
+	index->size--;
+}
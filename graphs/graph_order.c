@@ -0,0 +1,173 @@
+#include "graphs.h"
+
+/**
+ * graph_order_by_degree - program that computes an ordering of the
+ * vertices of a graph by decreasing number of edges
+ *
+ * the vertices are counting-sorted on their number of edges, ties keeping
+ * the order of their indices; giving the high-degree vertices, which most
+ * edges lead to, neighboring indices packs the hottest part of a skewed
+ * graph into a few cache lines
+ *
+ * @graph: the graph to order
+ *
+ * Return: an array of nb_vertices new indices indexed by current vertex
+ * index, to be handed to graph_relabel, or NULL on failure; it must be
+ * freed by the caller
+ */
+
+size_t *graph_order_by_degree(const graph_t *graph)
+{
+	size_t *perm, *count, max_degree = 0, i, pos, tmp;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+	for (i = 0; i < graph->nb_vertices; i++)
+		if (graph->vertex_table[i]->nb_edges > max_degree)
+			max_degree = graph->vertex_table[i]->nb_edges;
+
+	perm = malloc(graph->nb_vertices * sizeof(size_t));
+	count = calloc(max_degree + 1, sizeof(size_t));
+	if (!perm || !count)
+	{
+		free(perm);
+		free(count);
+		return (NULL);
+	}
+
+/* Count the vertices of each degree, from the highest degree down */
+	for (i = 0; i < graph->nb_vertices; i++)
+		count[max_degree - graph->vertex_table[i]->nb_edges]++;
+	for (i = 0, pos = 0; i <= max_degree; i++)
+	{
+		tmp = count[i];
+		count[i] = pos;
+		pos += tmp;
+	}
+	for (i = 0; i < graph->nb_vertices; i++)
+	{
+		tmp = max_degree - graph->vertex_table[i]->nb_edges;
+		perm[i] = count[tmp]++;
+	}
+
+	free(count);
+	return (perm);
+}
+
+
+
+/**
+ * vertex_degree_cmp - program that compares two vertices by number of
+ * edges, then by index
+ *
+ * @a: a pointer to the first vertex pointer
+ * @b: a pointer to the second vertex pointer
+ *
+ * Return: a negative value, 0 or a positive value if @a sorts before,
+ * equal to, or after @b
+ */
+
+int vertex_degree_cmp(const void *a, const void *b)
+{
+	const vertex_t *va = *(vertex_t * const *)a;
+	const vertex_t *vb = *(vertex_t * const *)b;
+
+	if (va->nb_edges != vb->nb_edges)
+		return ((va->nb_edges < vb->nb_edges) ? -1 : 1);
+	if (va->index != vb->index)
+		return ((va->index < vb->index) ? -1 : 1);
+	return (0);
+}
+
+
+
+/**
+ * order_rcm_tree - program that appends to a Cuthill-McKee ordering the
+ * vertices reachable from a root
+ *
+ * this is a breadth-first traversal in which the newly discovered
+ * neighbors of each vertex are queued by increasing number of edges
+ *
+ * @root: the undiscovered vertex to start from
+ * @queue: the ordering being built, used as the queue of the traversal
+ * @tail: the number of vertices already in @queue
+ * @visited: a bitset of the vertices already in @queue
+ *
+ * Return: the number of vertices in @queue afterwards
+ */
+
+size_t order_rcm_tree(vertex_t *root, vertex_t **queue, size_t tail,
+		      unsigned long *visited)
+{
+	size_t head, first;
+	edge_t *edge;
+
+	BITSET_SET(visited, root->index);
+	queue[tail++] = root;
+	for (head = tail - 1; head < tail; head++)
+	{
+		first = tail;
+		for (edge = queue[head]->edges; edge; edge = edge->next)
+		{
+			if (BITSET_TEST(visited, edge->dest->index))
+				continue;
+			BITSET_SET(visited, edge->dest->index);
+			queue[tail++] = edge->dest;
+		}
+		qsort(queue + first, tail - first, sizeof(vertex_t *),
+		      vertex_degree_cmp);
+	}
+
+	return (tail);
+}
+
+
+
+/**
+ * graph_order_rcm - program that computes the reverse Cuthill-McKee
+ * ordering of the vertices of a graph
+ *
+ * each tree of the ordering is grown breadth-first from the undiscovered
+ * vertex with the fewest edges, and the whole ordering is then reversed;
+ * vertices end up close to the vertices their edges lead to, so that
+ * traversals touch neighboring memory; only the edges leaving a vertex
+ * are followed, so on a directed graph this is an approximation
+ *
+ * @graph: the graph to order
+ *
+ * Return: an array of nb_vertices new indices indexed by current vertex
+ * index, to be handed to graph_relabel, or NULL on failure; it must be
+ * freed by the caller
+ */
+
+size_t *graph_order_rcm(const graph_t *graph)
+{
+	vertex_t **queue = NULL, **roots = NULL;
+	unsigned long *visited = NULL;
+	size_t *perm = NULL, n, i, tail = 0;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+	n = graph->nb_vertices;
+	queue = malloc(n * sizeof(vertex_t *));
+	roots = malloc(n * sizeof(vertex_t *));
+	visited = calloc(BITSET_WORDS(n), sizeof(unsigned long));
+	if (queue && roots && visited)
+		perm = malloc(n * sizeof(size_t));
+
+	if (perm)
+	{
+		memcpy(roots, graph->vertex_table, n * sizeof(vertex_t *));
+		qsort(roots, n, sizeof(vertex_t *), vertex_degree_cmp);
+		for (i = 0; i < n; i++)
+			if (!BITSET_TEST(visited, roots[i]->index))
+				tail = order_rcm_tree(roots[i], queue, tail,
+						      visited);
+		for (i = 0; i < n; i++)
+			perm[queue[i]->index] = n - 1 - i;
+	}
+	free(queue);
+	free(roots);
+	free(visited);
+	return (perm);
+}
@@ -0,0 +1,221 @@
+#include "graphs.h"
+
+/**
+ * relabel_check - program that checks that an array is a permutation
+ *
+ * @perm: the array to check
+ * @n: the number of elements of @perm
+ *
+ * Return: 1 if @perm holds every value in [0, @n) exactly once, 0 if it
+ * does not or if memory allocation fails
+ */
+
+int relabel_check(const size_t *perm, size_t n)
+{
+	unsigned long *seen;
+	size_t i;
+	int ok = 1;
+
+	seen = calloc(BITSET_WORDS(n), sizeof(unsigned long));
+	if (!seen)
+		return (0);
+
+	for (i = 0; ok && i < n; i++)
+	{
+		if (perm[i] >= n || BITSET_TEST(seen, perm[i]))
+			ok = 0;
+		else
+			BITSET_SET(seen, perm[i]);
+	}
+
+	free(seen);
+	return (ok);
+}
+
+
+
+/**
+ * relabel_edges - program that moves the edges of a relabeled graph into
+ * a contiguous block, in the order of the new vertex indices
+ *
+ * the new vertices still point to their old edges, whose destinations are
+ * still the old vertices: each edge is copied, weight included, with its
+ * destination translated, then the old edge and reverse adjacency node
+ * are freed
+ *
+ * @graph: the graph being relabeled
+ * @perm: the new index of each vertex, indexed by old index
+ * @vertices: the array of the new vertices, by new index
+ * @block: the memory to copy the edges into
+ *
+ * Return: nothing (void)
+ */
+
+void relabel_edges(graph_t *graph, const size_t *perm, vertex_t *vertices,
+		   char *block)
+{
+	size_t i, size = graph_edge_size(graph);
+	edge_t *edge, *next, *copy;
+
+	for (i = 0; i < graph->nb_vertices; i++)
+	{
+		edge = vertices[i].edges;
+		vertices[i].edges = NULL;
+		vertices[i].edges_tail = NULL;
+		vertices[i].nb_edges = 0;
+		for (; edge; edge = next)
+		{
+			next = edge->next;
+			copy = (edge_t *)block;
+			block += size;
+			memcpy(copy, edge, size);
+			copy->dest = &vertices[perm[edge->dest->index]];
+			vertex_link_edge(&vertices[i], copy);
+			graph_free(graph, edge);
+		}
+		for (edge = vertices[i].in_edges; edge; edge = next)
+		{
+			next = edge->next;
+			graph_free(graph, edge);
+		}
+		vertices[i].in_edges = NULL;
+	}
+}
+
+
+
+/**
+ * relabel_reverse - program that rebuilds the reverse adjacency of
+ * a relabeled graph into a contiguous block
+ *
+ * the edges are linked again to their source vertices, in the same order,
+ * so that their links and reverse adjacency nodes are set
+ *
+ * @graph: the relabeled graph
+ * @in_edges: an array of as many in_edge_t as the graph has edges
+ *
+ * Return: nothing (void)
+ */
+
+void relabel_reverse(graph_t *graph, in_edge_t *in_edges)
+{
+	vertex_t *vertex;
+	edge_t *edge, *next;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		edge = vertex->edges;
+		vertex->edges = NULL;
+		vertex->edges_tail = NULL;
+		vertex->nb_edges = 0;
+		for (; edge; edge = next)
+		{
+			next = edge->next;
+			graph_link_edge(graph, vertex, edge, &in_edges->edge);
+			in_edges++;
+		}
+	}
+}
+
+
+
+/**
+ * relabel_vertices - program that replaces the vertices of a graph with
+ * their relabeled copies
+ *
+ * the hash index is updated in place, since the contents and their hashes
+ * do not change, then the old vertices are freed and the new ones are
+ * linked in the order of their indices
+ *
+ * @graph: the graph being relabeled
+ * @perm: the new index of each vertex, indexed by old index
+ * @vertices: the array of the new vertices, by new index
+ *
+ * Return: nothing (void)
+ */
+
+void relabel_vertices(graph_t *graph, const size_t *perm, vertex_t *vertices)
+{
+	vertex_slot_t *slot;
+	vertex_t *vertex, *next;
+	size_t i, n = graph->nb_vertices;
+
+	for (i = 0; i < graph->lookup.capacity; i++)
+	{
+		slot = &graph->lookup.slots[i];
+		if (slot->vertex)
+			slot->vertex = &vertices[perm[slot->vertex->index]];
+	}
+	for (vertex = graph->vertices; vertex; vertex = next)
+	{
+		next = vertex->next;
+		graph_free(graph, vertex);
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		vertices[i].prev = i ? &vertices[i - 1] : NULL;
+		vertices[i].next = (i + 1 < n) ? &vertices[i + 1] : NULL;
+		graph->vertex_table[i] = &vertices[i];
+	}
+	graph->vertices = &vertices[0];
+	graph->vertices_tail = &vertices[n - 1];
+}
+
+
+
+/**
+ * graph_relabel - program that renumbers the vertices of a graph and
+ * reorders their storage accordingly
+ *
+ * the vertices are moved into one array, in the order of their new
+ * indices, followed by all the edges, grouped by source vertex in the same
+ * order, so that traversals walk memory mostly forward instead of chasing
+ * pointers across the heap (see graph_order_by_degree and graph_order_rcm);
+ * the array is a block owned by the graph, released by graph_delete;
+ * every vertex_t and edge_t pointer into the graph is invalidated, and the
+ * memory of the old vertices and edges is only reclaimed if it came from
+ * malloc
+ *
+ * @graph: the graph to relabel
+ * @perm: the new index of each vertex, indexed by current index, which
+ * must be a permutation of [0, nb_vertices)
+ *
+ * Return: 1 on success, 0 on failure, in which case the graph is untouched
+ */
+
+int graph_relabel(graph_t *graph, const size_t *perm)
+{
+	size_t nb_edges = 0, size, i, n;
+	vertex_t *vertices, *vertex;
+	char *block;
+
+	if (!graph || !perm)
+		return (0);
+	n = graph->nb_vertices;
+	if (!n)
+		return (1);
+	if (!relabel_check(perm, n))
+		return (0);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		nb_edges += vertex->nb_edges;
+	size = n * sizeof(vertex_t) + nb_edges * graph_edge_size(graph);
+	block = graph_slab_alloc(graph, size + (graph->reverse ? nb_edges *
+						sizeof(in_edge_t) : 0));
+	if (!block)
+		return (0);
+
+	vertices = (vertex_t *)block;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		i = perm[vertex->index];
+		vertices[i] = *vertex;
+		vertices[i].index = i;
+	}
+	relabel_edges(graph, perm, vertices, block + n * sizeof(vertex_t));
+	relabel_vertices(graph, perm, vertices);
+	if (graph->reverse)
+		relabel_reverse(graph, (in_edge_t *)(block + size));
+	graph_rehash_edges(graph);
+	return (1);
+}
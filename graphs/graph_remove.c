@@ -0,0 +1,170 @@
+#include "graphs.h"
+
+/**
+ * vertex_unlink_edge - program that unlinks an edge from the edge list of
+ * its source vertex
+ *
+ * when the graph maintains its reverse adjacency, the edge knows the
+ * previous one, so it is unlinked in constant time; otherwise the edge
+ * list is walked up to it; the tail pointer and the number of edges of
+ * @src_vertex are kept up to date, and the edge itself is not freed
+ *
+ * @graph: the graph the vertex belongs to
+ * @src_vertex: the source vertex of the edge
+ * @edge: the edge to unlink, which must be in the edge list of @src_vertex
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_unlink_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge)
+{
+	edge_t *prev = NULL;
+
+	if (graph->reverse)
+	{
+		prev = EDGE_LINK(graph, edge)->prev;
+		if (edge->next)
+			EDGE_LINK(graph, edge->next)->prev = prev;
+	}
+	else if (src_vertex->edges != edge)
+	{
+		prev = src_vertex->edges;
+		while (prev->next != edge)
+			prev = prev->next;
+	}
+
+	if (prev)
+		prev->next = edge->next;
+	else
+		src_vertex->edges = edge->next;
+	if (src_vertex->edges_tail == edge)
+		src_vertex->edges_tail = prev;
+	src_vertex->nb_edges--;
+}
+
+
+
+/**
+ * vertex_unlink_in_edge - program that unlinks a reverse adjacency node
+ * from the in_edges list of a vertex, in constant time
+ *
+ * @dest_vertex: the vertex whose in_edges list holds the node
+ * @in_edge: the node to unlink, which is not freed
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_unlink_in_edge(vertex_t *dest_vertex, edge_t *in_edge)
+{
+	edge_link_t *link = IN_EDGE_LINK(in_edge);
+
+	if (link->prev)
+		link->prev->next = in_edge->next;
+	else
+		dest_vertex->in_edges = in_edge->next;
+	if (in_edge->next)
+		IN_EDGE_LINK(in_edge->next)->prev = link->prev;
+}
+
+
+
+/**
+ * graph_drop_edge - program that removes an edge from a graph, and frees it
+ *
+ * the edge is forgotten by the edge hash set if the graph has one, and its
+ * reverse adjacency node, if the graph maintains them, is unlinked through
+ * the links of the edge and freed too
+ *
+ * @graph: the graph the vertices belong to
+ * @src_vertex: the source vertex of the edge
+ * @edge: the edge to remove
+ *
+ * Return: nothing (void)
+ */
+
+void graph_drop_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge)
+{
+	edge_t *in_edge;
+
+	vertex_unlink_edge(graph, src_vertex, edge);
+	if (graph->edge_set)
+		edge_set_remove(graph->edge_set, src_vertex, edge);
+	if (graph->reverse)
+	{
+		in_edge = EDGE_LINK(graph, edge)->twin;
+		vertex_unlink_in_edge(edge->dest, in_edge);
+		graph_free(graph, in_edge);
+	}
+	graph_free(graph, edge);
+}
+
+
+
+/**
+ * graph_disconnect - program that removes a directed edge between two
+ * vertices of a graph
+ *
+ * only one edge is removed if the vertices are linked by parallel edges;
+ * it is found through the edge hash set if the graph has one, by walking
+ * the edge list of @src_vertex otherwise
+ *
+ * @graph: the graph the vertices belong to
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ *
+ * Return: 1 if an edge was removed, 0 if there was none
+ */
+
+int graph_disconnect(graph_t *graph, vertex_t *src_vertex,
+		     vertex_t *dest_vertex)
+{
+	edge_t *edge;
+
+	edge = graph_find_edge(graph, src_vertex, dest_vertex);
+	if (!edge)
+		return (0);
+
+	graph_drop_edge(graph, src_vertex, edge);
+	return (1);
+}
+
+
+
+/**
+ * graph_remove_edge - program that removes an edge between two vertices
+ * of a graph
+ *
+ * the vertices are found through the vertex hash index, and the edge
+ * through graph_disconnect, so at most the edge list of its source vertex
+ * is walked; a bidirectional removal removes the edges existing in both
+ * directions
+ *
+ * @graph: the graph from which the edge should be removed
+ * @src: the content of the source vertex of the edge
+ * @dest: the content of the destination vertex of the edge
+ * @type: UNIDIRECTIONAL to remove the edge from @src to @dest only,
+ * BIDIRECTIONAL to also remove the edge from @dest to @src
+ *
+ * Return: 1 if every requested edge existed and was removed, 0 otherwise
+ */
+
+int graph_remove_edge(graph_t *graph, const char *src,
+		      const char *dest, edge_type_t type)
+{
+	vertex_t *src_vertex, *dest_vertex;
+	int ret;
+
+	if (!graph || !src || !dest ||
+	    (type != UNIDIRECTIONAL && type != BIDIRECTIONAL))
+		return (0);
+
+	src_vertex = vertex_index_find(&graph->lookup, src);
+	dest_vertex = vertex_index_find(&graph->lookup, dest);
+	if (!src_vertex || !dest_vertex)
+		return (0);
+
+	ret = graph_disconnect(graph, src_vertex, dest_vertex);
+	if (type == BIDIRECTIONAL)
+		ret = graph_disconnect(graph, dest_vertex, src_vertex) && ret;
+	return (ret);
+}
@@ -0,0 +1,179 @@
+#include "graphs.h"
+
+/**
+ * graph_detach_out_edges - program that removes all the edges leaving
+ * a vertex of a graph that maintains its reverse adjacency
+ *
+ * each edge, and its reverse adjacency node, is unlinked in constant time;
+ * the pairs of vertices of the edges are dropped at once from the edge
+ * hash set, if any, since no edge is left between them
+ *
+ * @graph: the graph the vertex belongs to
+ * @vertex: the vertex whose edges should be removed
+ *
+ * Return: nothing (void)
+ */
+
+void graph_detach_out_edges(graph_t *graph, vertex_t *vertex)
+{
+	edge_slot_t *slot;
+	edge_t *edge;
+
+	while (vertex->edges)
+	{
+		edge = vertex->edges;
+		slot = NULL;
+		if (graph->edge_set)
+			slot = edge_set_find(graph->edge_set, vertex,
+					     edge->dest);
+		if (slot)
+			slot->count = 1;
+		graph_drop_edge(graph, vertex, edge);
+	}
+}
+
+
+
+/**
+ * graph_detach_in_edges - program that removes all the edges leading to
+ * a vertex of a graph that maintains its reverse adjacency
+ *
+ * the edges are found through the in_edges list of @vertex, and each of
+ * them is unlinked from the edge list of its source vertex in constant
+ * time; as in graph_detach_out_edges, their pairs of vertices are dropped
+ * at once from the edge hash set
+ *
+ * @graph: the graph the vertex belongs to
+ * @vertex: the vertex whose incoming edges should be removed
+ *
+ * Return: nothing (void)
+ */
+
+void graph_detach_in_edges(graph_t *graph, vertex_t *vertex)
+{
+	edge_slot_t *slot;
+	edge_t *in_edge;
+
+	while (vertex->in_edges)
+	{
+		in_edge = vertex->in_edges;
+		slot = NULL;
+		if (graph->edge_set)
+			slot = edge_set_find(graph->edge_set, in_edge->dest,
+					     vertex);
+		if (slot)
+			slot->count = 1;
+		graph_drop_edge(graph, in_edge->dest,
+				IN_EDGE_LINK(in_edge)->twin);
+	}
+}
+
+
+
+/**
+ * vertex_list_unlink - program that unlinks a vertex from the adjacency
+ * linked list of a graph
+ *
+ * @graph: the graph the vertex belongs to
+ * @vertex: the vertex to unlink
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_list_unlink(graph_t *graph, vertex_t *vertex)
+{
+	if (vertex->prev)
+		vertex->prev->next = vertex->next;
+	else
+		graph->vertices = vertex->next;
+	if (vertex->next)
+		vertex->next->prev = vertex->prev;
+	else
+		graph->vertices_tail = vertex->prev;
+}
+
+
+
+/**
+ * graph_unlink_vertex - program that unlinks a vertex from a graph
+ *
+ * the vertex is removed from the hash index and from the adjacency linked
+ * list; to keep the indices of the vertices in [0, nb_vertices), the vertex
+ * with the last index takes the index of the removed one, and its place in
+ * the adjacency linked list too, so that the list stays in index order and
+ * the list traversals start from the same vertex as the CSR ones; removing
+ * a vertex renumbers at most one other vertex
+ *
+ * @graph: the graph the vertex belongs to
+ * @vertex: the vertex to unlink, which must have no edge left
+ *
+ * Return: nothing (void)
+ */
+
+void graph_unlink_vertex(graph_t *graph, vertex_t *vertex)
+{
+	vertex_t *last;
+
+	vertex_index_remove(&graph->lookup, vertex);
+	last = graph->vertex_table[--graph->nb_vertices];
+	graph->vertex_table[graph->nb_vertices] = NULL;
+	if (last == vertex)
+	{
+		vertex_list_unlink(graph, vertex);
+		return;
+	}
+
+	vertex_list_unlink(graph, last);
+	last->prev = vertex->prev;
+	last->next = vertex->next;
+	if (last->prev)
+		last->prev->next = last;
+	else
+		graph->vertices = last;
+	if (last->next)
+		last->next->prev = last;
+	else
+		graph->vertices_tail = last;
+	last->index = vertex->index;
+	graph->vertex_table[last->index] = last;
+}
+
+
+
+/**
+ * graph_remove_vertex - program that removes a vertex, and all the edges
+ * leaving it or leading to it, from a graph
+ *
+ * the graph must maintain its reverse adjacency (see graph_track_reverse),
+ * so that the edges leading to the vertex are known and every edge of the
+ * vertex is unlinked in constant time: the cost is proportional to the
+ * degree of the vertex; the vertex is found through the vertex hash index,
+ * and the vertex that had the last index is given the index and the list
+ * position of the removed one
+ *
+ * @graph: the graph from which the vertex should be removed
+ * @str: the content of the vertex to remove
+ *
+ * Return: 1 if the vertex was removed, 0 if there is no such vertex or
+ * the graph does not maintain its reverse adjacency
+ */
+
+int graph_remove_vertex(graph_t *graph, const char *str)
+{
+	vertex_t *vertex;
+
+	if (!graph || !str || !graph->reverse)
+		return (0);
+
+	vertex = vertex_index_find(&graph->lookup, str);
+	if (!vertex)
+		return (0);
+
+	graph_detach_out_edges(graph, vertex);
+	graph_detach_in_edges(graph, vertex);
+	graph_unlink_vertex(graph, vertex);
+
+	graph_free(graph, vertex->content);
+	graph_free(graph, vertex);
+	return (1);
+}
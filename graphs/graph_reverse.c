@@ -0,0 +1,148 @@
+#include "graphs.h"
+
+/**
+ * vertex_link_in_edge - program that records an edge in the reverse
+ * adjacency of its destination vertex
+ *
+ * the node is prepended to the in_edges list of @dest_vertex, its dest
+ * member pointing back to @src_vertex; the order of the in_edges lists
+ * is not meaningful, so no tail pointer is needed
+ *
+ * @dest_vertex: the vertex the edge leads to
+ * @edge: an allocated in_edge_t to use as reverse adjacency node
+ * @src_vertex: the vertex the edge starts from
+ *
+ * Return: nothing (void)
+ */
+
+void vertex_link_in_edge(vertex_t *dest_vertex, edge_t *edge,
+			 vertex_t *src_vertex)
+{
+	edge->dest = src_vertex;
+	edge->next = dest_vertex->in_edges;
+	IN_EDGE_LINK(edge)->prev = NULL;
+	if (edge->next)
+		IN_EDGE_LINK(edge->next)->prev = edge;
+	dest_vertex->in_edges = edge;
+}
+
+
+
+/**
+ * graph_link_edge - program that appends an edge to the edge list of
+ * a vertex of a graph
+ *
+ * when the graph maintains its reverse adjacency, @in_edge is linked to
+ * the in_edges list of the destination of the edge, and the links of both
+ * nodes are set, so either can later be unlinked in constant time
+ *
+ * @graph: the graph the vertex belongs to
+ * @src_vertex: the source vertex of the edge
+ * @edge: the edge to append, its dest member must already be set
+ * @in_edge: an allocated in_edge_t, ignored if the graph does not
+ * maintain its reverse adjacency
+ *
+ * Return: nothing (void)
+ */
+
+void graph_link_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge,
+		     edge_t *in_edge)
+{
+	edge_link_t *link;
+
+	if (graph->reverse)
+	{
+		link = EDGE_LINK(graph, edge);
+		link->prev = src_vertex->edges_tail;
+		link->twin = in_edge;
+		vertex_link_in_edge(edge->dest, in_edge, src_vertex);
+		IN_EDGE_LINK(in_edge)->twin = edge;
+	}
+	vertex_link_edge(src_vertex, edge);
+}
+
+
+
+/**
+ * reverse_move_edges - program that moves the edges of a vertex into
+ * a block of memory, giving each of them its links and its reverse
+ * adjacency node
+ *
+ * @graph: the graph, which already maintains its reverse adjacency
+ * @vertex: the vertex whose edges should be moved
+ * @block: a pointer to the next free byte of the block, moved past the
+ * edges and reverse adjacency nodes carved out of it
+ * @old_size: the size of the edges before they had links
+ *
+ * Return: nothing (void)
+ */
+
+void reverse_move_edges(graph_t *graph, vertex_t *vertex, char **block,
+			size_t old_size)
+{
+	size_t size = graph_edge_size(graph);
+	edge_t *edge, *next, *copy;
+
+	edge = vertex->edges;
+	vertex->edges = NULL;
+	vertex->edges_tail = NULL;
+	vertex->nb_edges = 0;
+	for (; edge; edge = next)
+	{
+		next = edge->next;
+		copy = (edge_t *)*block;
+		memcpy(copy, edge, old_size);
+		*block += size;
+		graph_link_edge(graph, vertex, copy, (edge_t *)*block);
+		*block += sizeof(in_edge_t);
+		graph_free(graph, edge);
+	}
+}
+
+
+
+/**
+ * graph_track_reverse - program that makes a graph maintain the reverse
+ * adjacency of its vertices
+ *
+ * every edge gets a reverse adjacency node in the in_edges list of its
+ * destination, and both nodes are doubly linked and paired with each
+ * other, which is what lets graph_remove_vertex remove a vertex in time
+ * proportional to its degree; the edges already in the graph are moved,
+ * with their new nodes, into one block owned by the graph, so every
+ * edge_t pointer into the graph is invalidated; later insertions and
+ * removals keep the lists up to date
+ *
+ * @graph: the graph to extend, left untouched if it already tracks
+ * its reverse adjacency
+ *
+ * Return: 1 on success, 0 on failure, in which case the graph is left
+ * untouched
+ */
+
+int graph_track_reverse(graph_t *graph)
+{
+	size_t nb_edges = 0, old_size;
+	vertex_t *vertex;
+	char *block = NULL;
+
+	if (!graph)
+		return (0);
+	if (graph->reverse)
+		return (1);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		nb_edges += vertex->nb_edges;
+	old_size = graph_edge_size(graph);
+	if (nb_edges)
+		block = graph_slab_alloc(graph, nb_edges * (old_size +
+			sizeof(edge_link_t) + sizeof(in_edge_t)));
+	if (nb_edges && !block)
+		return (0);
+
+	graph->reverse = 1;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		reverse_move_edges(graph, vertex, &block, old_size);
+	graph_rehash_edges(graph);
+	return (1);
+}
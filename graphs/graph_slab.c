@@ -0,0 +1,176 @@
+#include "graphs.h"
+
+/**
+ * graph_slab_alloc - program that allocates a block of memory owned
+ * by a graph
+ *
+ * the block is released when the graph is deleted, and must not be
+ * freed before;
+ * for a graph created with graph_create_arena, the block is carved out of
+ * the current chunk when it fits; a large block (over a quarter of
+ * GRAPH_ARENA_CHUNK) that does not fit gets a dedicated chunk, and the
+ * current chunk keeps serving the next blocks, so at most a quarter of
+ * a chunk is ever left unused when a new current chunk of
+ * GRAPH_ARENA_CHUNK bytes is allocated;
+ * for any other graph, every block gets its own slab
+ *
+ * @graph: the graph owning the block
+ * @size: the size of the block, in bytes
+ *
+ * Return: a pointer to the block, or NULL if memory allocation fails
+ */
+
+void *graph_slab_alloc(graph_t *graph, size_t size)
+{
+	graph_slab_t *slab = graph->slabs;
+	size_t capacity;
+	void *ptr;
+
+	size = (size + GRAPH_SLAB_ALIGN - 1) & ~(size_t)(GRAPH_SLAB_ALIGN - 1);
+	if (graph->arena && slab && slab->size - slab->used >= size)
+	{
+		ptr = (char *)(slab + 1) + slab->used;
+		slab->used += size;
+		return (ptr);
+	}
+
+	capacity = size;
+	if (graph->arena && capacity <= GRAPH_ARENA_CHUNK / 4)
+		capacity = GRAPH_ARENA_CHUNK;
+	GRAPH_COUNT(graph, allocations, 1);
+	slab = malloc(sizeof(graph_slab_t) + capacity);
+	if (!slab)
+		return (NULL);
+	if (!graph_slab_insert(graph, slab))
+	{
+		free(slab);
+		return (NULL);
+	}
+
+	slab->size = capacity;
+	slab->used = size;
+	if (graph->arena && graph->slabs && capacity == size)
+	{
+		slab->next = graph->slabs->next;
+		graph->slabs->next = slab;
+		return (slab + 1);
+	}
+	slab->next = graph->slabs;
+	graph->slabs = slab;
+	return (slab + 1);
+}
+
+
+
+/**
+ * graph_slab_insert - program that records a new block of memory in the
+ * table of the blocks owned by a graph, sorted by address
+ *
+ * the table grows geometrically, and the position of the block is found
+ * by binary search, the blocks at higher addresses being moved up at once;
+ * the blocks of an arena graph are not recorded, since graph_free never
+ * looks them up
+ *
+ * @graph: the graph
+ * @slab: the new block
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int graph_slab_insert(graph_t *graph, graph_slab_t *slab)
+{
+	graph_slab_t **table = graph->slab_table;
+	size_t low = 0, high = graph->nb_slabs, mid, capacity;
+
+	if (graph->arena)
+		return (1);
+	if (graph->nb_slabs == graph->slab_capacity)
+	{
+		capacity = graph->slab_capacity ? graph->slab_capacity * 2 : 8;
+		table = realloc(table, capacity * sizeof(graph_slab_t *));
+		if (!table)
+			return (0);
+		graph->slab_table = table;
+		graph->slab_capacity = capacity;
+	}
+
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if (table[mid] < slab)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	memmove(table + low + 1, table + low,
+		(graph->nb_slabs - low) * sizeof(graph_slab_t *));
+	table[low] = slab;
+	graph->nb_slabs++;
+	return (1);
+}
+
+
+
+/**
+ * graph_slab_owns - program that checks whether some memory belongs
+ * to one of the blocks owned by a graph
+ *
+ * the block starting at the highest address not above @ptr is found by
+ * binary search in the sorted table of blocks, so the cost is logarithmic
+ * in the number of blocks, however many batches were inserted
+ *
+ * @graph: the graph
+ * @ptr: the address to check
+ *
+ * Return: 1 if @ptr lies in a block owned by the graph, 0 otherwise
+ */
+
+int graph_slab_owns(const graph_t *graph, const void *ptr)
+{
+	const graph_slab_t *slab;
+	const char *start;
+	size_t low = 0, high = graph->nb_slabs, mid;
+
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if ((const char *)graph->slab_table[mid] <= (const char *)ptr)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (!low)
+		return (0);
+
+	slab = graph->slab_table[low - 1];
+	start = (const char *)(slab + 1);
+	return ((const char *)ptr >= start &&
+		(const char *)ptr < start + slab->size);
+}
+
+
+
+/**
+ * graph_slab_free - program that releases all the blocks of memory
+ * owned by a graph
+ *
+ * @graph: the graph
+ *
+ * Return: nothing (void)
+ */
+
+void graph_slab_free(graph_t *graph)
+{
+	graph_slab_t *slab;
+
+	while (graph->slabs)
+	{
+		slab = graph->slabs;
+		graph->slabs = slab->next;
+		free(slab);
+	}
+	free(graph->slab_table);
+	graph->slab_table = NULL;
+	graph->nb_slabs = 0;
+	graph->slab_capacity = 0;
+}
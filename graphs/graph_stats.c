@@ -0,0 +1,161 @@
+#include "graphs.h"
+
+/**
+ * degree_bucket - program that finds the bucket of a degree in a degree
+ * histogram
+ *
+ * @degree: the number of edges of a vertex
+ *
+ * Return: 0 for a degree of 0, the number of bits of @degree otherwise
+ */
+
+size_t degree_bucket(size_t degree)
+{
+	size_t bucket = 0;
+
+	while (degree)
+	{
+		bucket++;
+		degree >>= 1;
+	}
+
+	return (bucket);
+}
+
+
+
+/**
+ * stats_memory - program that measures the memory footprint of a graph,
+ * by category
+ *
+ * @graph: the graph to measure
+ * @stats: the statistics to fill, whose edge counts are already set
+ *
+ * Return: nothing (void)
+ */
+
+void stats_memory(const graph_t *graph, graph_stats_t *stats)
+{
+	const graph_slab_t *slab;
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t in_edges = 0;
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		stats->string_bytes += strlen(vertex->content) + 1;
+		for (edge = vertex->in_edges; edge; edge = edge->next)
+			in_edges++;
+	}
+
+	stats->vertex_bytes = graph->nb_vertices * sizeof(vertex_t) +
+		graph->table_capacity * sizeof(vertex_t *);
+	stats->edge_bytes = stats->nb_edges * graph_edge_size(graph) +
+		in_edges * sizeof(in_edge_t);
+	stats->index_bytes = graph->lookup.capacity * sizeof(vertex_slot_t);
+	if (graph->edge_set)
+		stats->index_bytes += sizeof(edge_set_t) +
+			graph->edge_set->capacity * sizeof(edge_slot_t);
+	stats->block_bytes = graph->slab_capacity * sizeof(graph_slab_t *);
+	for (slab = graph->slabs; slab; slab = slab->next)
+		stats->block_bytes += sizeof(graph_slab_t) + slab->size;
+}
+
+
+
+/**
+ * graph_stats - program that computes the statistics of a graph
+ *
+ * the edges are counted from the nb_edges member of the vertices, so the
+ * cost is linear in the number of vertices, plus the reverse adjacency
+ * nodes if the graph maintains them
+ *
+ * @graph: the graph to measure
+ * @stats: a pointer to the statistics to fill
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_stats(const graph_t *graph, graph_stats_t *stats)
+{
+	vertex_t *vertex;
+
+	if (!graph || !stats)
+		return (0);
+
+	memset(stats, 0, sizeof(graph_stats_t));
+	stats->nb_vertices = graph->nb_vertices;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		stats->nb_edges += vertex->nb_edges;
+		if (vertex->nb_edges > stats->max_degree)
+			stats->max_degree = vertex->nb_edges;
+		stats->degrees[degree_bucket(vertex->nb_edges)]++;
+	}
+	if (stats->nb_vertices)
+		stats->avg_degree = (double)stats->nb_edges /
+			stats->nb_vertices;
+
+	stats_memory(graph, stats);
+	return (1);
+}
+
+
+
+/**
+ * graph_set_counters - program that attaches profiling counters to a graph
+ *
+ * the counters are left as they are, so they can accumulate over several
+ * graphs; the traversals only pay for a test of the pointer when no
+ * counters are attached
+ *
+ * @graph: the graph to profile
+ * @counters: a pointer to the counters to increment, or NULL to detach
+ * the current ones
+ *
+ * Return: nothing (void)
+ */
+
+void graph_set_counters(graph_t *graph, graph_counters_t *counters)
+{
+	if (graph)
+		graph->counters = counters;
+}
+
+
+
+/**
+ * graph_count_traversal - program that reports a finished traversal to
+ * the profiling counters of a graph
+ *
+ * every vertex of @visited was visited and had all its edges scanned;
+ * counting them afterwards keeps the traversal loops untouched, and costs
+ * nothing when no counters are attached
+ *
+ * @graph: the traversed graph
+ * @visited: the bitset of the visited vertices, or NULL if the traversal
+ * failed midway, in which case only its allocations are counted since the
+ * edges of its visited vertices were not all scanned
+ * @allocations: the number of buffers the traversal allocated
+ *
+ * Return: nothing (void)
+ */
+
+void graph_count_traversal(const graph_t *graph, const unsigned long *visited,
+			   size_t allocations)
+{
+	graph_counters_t *counters = graph->counters;
+	size_t i;
+
+	if (!counters)
+		return;
+
+	counters->allocations += allocations;
+	for (i = 0; visited && i < graph->nb_vertices; i++)
+	{
+		if (!BITSET_TEST(visited, i))
+			continue;
+		counters->vertices_visited++;
+		counters->edges_scanned += graph->vertex_table[i]->nb_edges;
+	}
+}
@@ -0,0 +1,159 @@
+#include "graphs.h"
+
+/**
+ * tarjan_visit - program that discovers a vertex during Tarjan's
+ * strongly connected components algorithm
+ *
+ * @tarjan: the state of the algorithm
+ * @vertex: the vertex discovered
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int tarjan_visit(tarjan_t *tarjan, vertex_t *vertex)
+{
+	size_t v = vertex->index;
+
+	tarjan->order[v] = ++tarjan->counter;
+	tarjan->low[v] = tarjan->counter;
+	tarjan->stack[tarjan->stack_size++] = v;
+	return (dfs_stack_push(&tarjan->dfs, vertex));
+}
+
+
+
+/**
+ * tarjan_close - program that finishes a vertex during Tarjan's
+ * strongly connected components algorithm
+ *
+ * a vertex that cannot reach any vertex discovered before it is the root
+ * of a component, made of the vertices stacked since its discovery
+ *
+ * @tarjan: the state of the algorithm
+ * @v: the index of the vertex whose edges have all been explored
+ *
+ * Return: nothing (void)
+ */
+
+void tarjan_close(tarjan_t *tarjan, size_t v)
+{
+	size_t w;
+
+	if (tarjan->low[v] != tarjan->order[v])
+		return;
+
+	do {
+		w = tarjan->stack[--tarjan->stack_size];
+		tarjan->labels[w] = tarjan->nb_components;
+	} while (w != v);
+	tarjan->nb_components++;
+}
+
+
+
+/**
+ * tarjan_run - program that runs Tarjan's strongly connected components
+ * algorithm from one vertex
+ *
+ * the recursion of the textbook algorithm is replaced by the explicit
+ * stack of frames used by depth_first_traverse, so that long paths cannot
+ * overflow the C stack; when a frame is popped, the low rank of its vertex
+ * is propagated to the vertex of the frame below
+ *
+ * @tarjan: the state of the algorithm
+ * @root: the undiscovered vertex to start from
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int tarjan_run(tarjan_t *tarjan, vertex_t *root)
+{
+	dfs_frame_t *frame;
+	vertex_t *dest;
+	size_t v, w;
+
+	if (!tarjan_visit(tarjan, root))
+		return (0);
+	while (tarjan->dfs.size)
+	{
+		frame = &tarjan->dfs.frames[tarjan->dfs.size - 1];
+		v = frame->vertex->index;
+		if (frame->edge)
+		{
+			dest = frame->edge->dest;
+			frame->edge = frame->edge->next;
+			w = dest->index;
+			if (!tarjan->order[w])
+			{
+				if (!tarjan_visit(tarjan, dest))
+					return (0);
+			}
+			else if (tarjan->labels[w] == GRAPH_NO_COMPONENT &&
+				 tarjan->order[w] < tarjan->low[v])
+				tarjan->low[v] = tarjan->order[w];
+			continue;
+		}
+		tarjan->dfs.size--;
+		tarjan_close(tarjan, v);
+		if (!tarjan->dfs.size)
+			break;
+		w = tarjan->dfs.frames[tarjan->dfs.size - 1].vertex->index;
+		if (tarjan->low[v] < tarjan->low[w])
+			tarjan->low[w] = tarjan->low[v];
+	}
+	return (1);
+}
+
+
+
+/**
+ * graph_strong_components - program that labels the strongly connected
+ * components of a graph
+ *
+ * the components are found by an iterative version of Tarjan's algorithm,
+ * in a single depth-first pass over the whole graph; two vertices share
+ * a component if each of them can reach the other
+ *
+ * @graph: the graph to label
+ * @nb_components: a pointer to store the number of components, or NULL
+ *
+ * Return: an array of nb_vertices component labels indexed by vertex index,
+ * or NULL on failure; the components are numbered from 0 in reverse
+ * topological order, so no edge leads from a component to a component of
+ * higher label; the array must be freed by the caller
+ */
+
+size_t *graph_strong_components(const graph_t *graph, size_t *nb_components)
+{
+	tarjan_t tarjan = {NULL, NULL, NULL, 0, 0, NULL, 0, {NULL, 0, 0, NULL}};
+	size_t n, v;
+	int ok;
+
+	if (!graph || !graph->nb_vertices)
+		return (NULL);
+	n = graph->nb_vertices;
+	tarjan.order = calloc(n, sizeof(size_t));
+	tarjan.low = malloc(n * sizeof(size_t));
+	tarjan.stack = malloc(n * sizeof(size_t));
+	tarjan.labels = malloc(n * sizeof(size_t));
+	ok = tarjan.order && tarjan.low && tarjan.stack && tarjan.labels;
+	if (ok)
+		memset(tarjan.labels, 0xff, n * sizeof(size_t));
+
+	for (v = 0; ok && v < n; v++)
+		if (!tarjan.order[v])
+			ok = tarjan_run(&tarjan, graph->vertex_table[v]);
+
+	free(tarjan.order);
+	free(tarjan.low);
+	free(tarjan.stack);
+	free(tarjan.dfs.frames);
+	if (!ok)
+	{
+		free(tarjan.labels);
+		return (NULL);
+	}
+	if (nb_components)
+		*nb_components = tarjan.nb_components;
+	return (tarjan.labels);
+}
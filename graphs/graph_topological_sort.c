@@ -0,0 +1,144 @@
+#include "graphs.h"
+
+/**
+ * topo_iter_init - program that prepares the iteration over the ready sets
+ * of a graph
+ *
+ * the in-degree of every vertex is counted in one pass over the edges, and
+ * the vertices without dependencies form the first ready set
+ *
+ * @iter: a pointer to the iterator to initialize
+ * @graph: the graph to iterate, it must not be modified meanwhile
+ *
+ * Return: 1 on success, 0 on failure, in which case nothing is left
+ * allocated
+ */
+
+int topo_iter_init(topo_iter_t *iter, const graph_t *graph)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+
+	if (!iter || !graph)
+		return (0);
+	iter->graph = graph;
+	iter->in_degree = calloc(graph->nb_vertices + 1, sizeof(size_t));
+	iter->ready = malloc((graph->nb_vertices + 1) * sizeof(vertex_t *));
+	if (!iter->in_degree || !iter->ready)
+	{
+		topo_iter_clear(iter);
+		return (0);
+	}
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		for (edge = vertex->edges; edge; edge = edge->next)
+			iter->in_degree[edge->dest->index]++;
+
+	iter->start = 0;
+	iter->end = 0;
+	iter->tail = 0;
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (!iter->in_degree[vertex->index])
+			iter->ready[iter->tail++] = vertex;
+	return (1);
+}
+
+
+
+/**
+ * topo_iter_next - program that retrieves the next ready set of a graph
+ *
+ * the vertices of the previous ready set are considered done: the edges
+ * leaving them are released, and the vertices whose last dependency this
+ * releases form the new ready set; the vertices of a ready set do not
+ * depend on each other, so they can be processed concurrently
+ *
+ * @iter: a pointer to the iterator
+ * @size: a pointer to store the number of vertices in the ready set
+ *
+ * Return: a pointer to the array of the vertices of the ready set, valid
+ * until the iterator is cleared, or NULL once every vertex that can be
+ * reached has been returned; if fewer than nb_vertices vertices were
+ * returned by then, the remaining ones are on or behind a cycle
+ */
+
+vertex_t **topo_iter_next(topo_iter_t *iter, size_t *size)
+{
+	edge_t *edge;
+	size_t i;
+
+	for (i = iter->start; i < iter->end; i++)
+	{
+		for (edge = iter->ready[i]->edges; edge; edge = edge->next)
+			if (!--iter->in_degree[edge->dest->index])
+				iter->ready[iter->tail++] = edge->dest;
+	}
+
+	iter->start = iter->end;
+	iter->end = iter->tail;
+	if (size)
+		*size = iter->end - iter->start;
+	if (iter->start == iter->end)
+		return (NULL);
+	return (iter->ready + iter->start);
+}
+
+
+
+/**
+ * topo_iter_clear - program that releases the memory of an iterator over
+ * the ready sets of a graph
+ *
+ * @iter: a pointer to the iterator
+ *
+ * Return: nothing (void)
+ */
+
+void topo_iter_clear(topo_iter_t *iter)
+{
+	free(iter->in_degree);
+	free(iter->ready);
+	iter->in_degree = NULL;
+	iter->ready = NULL;
+}
+
+
+
+/**
+ * graph_topological_sort - program that sorts the vertices of a graph so
+ * that every edge leads from a vertex to a vertex sorted after it
+ *
+ * this is Kahn's algorithm: the ready sets of topo_iter_next are exhausted
+ * one after the other, and their concatenation is a topological order,
+ * computed in time linear in the size of the graph
+ *
+ * @graph: the graph to sort
+ * @nb_sorted: a pointer to store the number of sorted vertices, which is
+ * less than nb_vertices if the graph has a cycle (see graph_find_cycle)
+ *
+ * Return: an array of nb_vertices vertex pointers, whose first @nb_sorted
+ * ones are sorted and the others, by increasing index, are the vertices
+ * on or behind a cycle, or NULL on failure; it must be freed by the caller
+ */
+
+vertex_t **graph_topological_sort(const graph_t *graph, size_t *nb_sorted)
+{
+	topo_iter_t iter;
+	size_t sorted, i;
+
+	if (!topo_iter_init(&iter, graph))
+		return (NULL);
+
+	while (topo_iter_next(&iter, NULL))
+		;
+
+/* The vertices never released still have dependencies left */
+	sorted = iter.tail;
+	for (i = 0; i < graph->nb_vertices; i++)
+		if (iter.in_degree[i])
+			iter.ready[iter.tail++] = graph->vertex_table[i];
+	free(iter.in_degree);
+	if (nb_sorted)
+		*nb_sorted = sorted;
+	return (iter.ready);
+}
@@ -0,0 +1,174 @@
+#include "graphs.h"
+
+/**
+ * graph_set_weight_type - program that chooses the kind of weight carried
+ * by the edges of a graph
+ *
+ * the edges of a weighted graph are allocated as weighted_edge_t, with
+ * the weight stored right after the edge, so a weighted graph costs one
+ * more word per edge and an unweighted graph nothing at all;
+ * graph_add_edge and graph_add_edges_batch give their edges a weight of 0
+ *
+ * @graph: the graph, which must not have any edge yet
+ * @type: the kind of weight of the edges
+ *
+ * Return: 1 on success, 0 if @type is invalid or the graph has edges
+ */
+
+int graph_set_weight_type(graph_t *graph, graph_weight_type_t type)
+{
+	vertex_t *vertex;
+
+	if (!graph || type < GRAPH_UNWEIGHTED || type > GRAPH_WEIGHT_DOUBLE)
+		return (0);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+		if (vertex->edges)
+			return (0);
+
+	graph->weight_type = type;
+	return (1);
+}
+
+
+
+/**
+ * graph_edge_size - program that computes the size of the edges of a graph
+ *
+ * an edge is an edge_t, followed by its weight if the graph is weighted,
+ * and by an edge_link_t if the graph maintains its reverse adjacency
+ *
+ * @graph: the graph
+ *
+ * Return: the size in bytes of an edge of the graph
+ */
+
+size_t graph_edge_size(const graph_t *graph)
+{
+	size_t size = sizeof(edge_t);
+
+	if (graph->weight_type != GRAPH_UNWEIGHTED)
+		size = sizeof(weighted_edge_t);
+	if (graph->reverse)
+		size += sizeof(edge_link_t);
+	return (size);
+}
+
+
+
+/**
+ * graph_connect_weighted - program that adds a weighted directed edge
+ * between two vertices of a weighted graph
+ *
+ * in unique-edges mode, an existing edge between the vertices is left
+ * unchanged, weight included, as graph_connect leaves it
+ *
+ * @graph: the graph the vertices belong to
+ * @src_vertex: the source vertex of the edge
+ * @dest_vertex: the destination vertex of the edge
+ * @weight: the weight of the new edge
+ *
+ * Return: 1 on success, 0 on failure, including when the graph is
+ * unweighted, as its edges have no room for a weight
+ */
+
+int graph_connect_weighted(graph_t *graph, vertex_t *src_vertex,
+			   vertex_t *dest_vertex, graph_weight_t weight)
+{
+	edge_t *edge;
+
+	if (graph->weight_type == GRAPH_UNWEIGHTED)
+		return (0);
+	if (graph->unique_edges &&
+	    graph_find_edge(graph, src_vertex, dest_vertex))
+		return (1);
+
+	edge = graph_connect(graph, src_vertex, dest_vertex);
+	if (!edge)
+		return (0);
+	EDGE_WEIGHT(edge) = weight;
+	return (1);
+}
+
+
+
+/**
+ * graph_add_weighted_edge - program that adds a weighted edge between two
+ * vertices of a weighted graph
+ *
+ * this works like graph_add_edge, a bidirectional edge being made of two
+ * edges of the same weight; the weight is then read in place with
+ * EDGE_WEIGHT while walking the edge lists; a vertex cannot be linked to
+ * itself, and in unique-edges mode an edge that already exists keeps its
+ * weight (see graph_set_unique_edges)
+ *
+ * @graph: the graph, made weighted with graph_set_weight_type
+ * @src: the content of the source vertex of the edge
+ * @dest: the content of the destination vertex of the edge
+ * @type: UNIDIRECTIONAL or BIDIRECTIONAL
+ * @weight: the weight of the edge, in the member matching the weight type
+ * of the graph
+ *
+ * Return: 1 on success, 0 on failure
+ */
+
+int graph_add_weighted_edge(graph_t *graph, const char *src, const char *dest,
+			    edge_type_t type, graph_weight_t weight)
+{
+	vertex_t *src_vertex, *dest_vertex;
+
+	if (!graph || !src || !dest || graph->weight_type == GRAPH_UNWEIGHTED ||
+	    (type != UNIDIRECTIONAL && type != BIDIRECTIONAL))
+		return (0);
+
+	src_vertex = vertex_index_find(&graph->lookup, src);
+	dest_vertex = vertex_index_find(&graph->lookup, dest);
+	if (!src_vertex || !dest_vertex || src_vertex == dest_vertex)
+		return (0);
+
+	if (!graph_connect_weighted(graph, src_vertex, dest_vertex, weight))
+		return (0);
+	if (type == BIDIRECTIONAL)
+		return (graph_connect_weighted(graph, dest_vertex, src_vertex,
+					       weight));
+	return (1);
+}
+
+
+
+/**
+ * graph_freeze_weights - program that copies the weights of the edges of
+ * a graph into a CSR snapshot
+ *
+ * the weights are stored in the order of the targets array, so the weight
+ * of the edge targets[i] is weights[i]
+ *
+ * @graph: the graph to snapshot
+ * @csr: the snapshot to fill, its offsets must already be computed
+ *
+ * Return: 1 on success, 0 if memory allocation fails
+ */
+
+int graph_freeze_weights(const graph_t *graph, graph_csr_t *csr)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+	size_t pos;
+
+	csr->weight_type = graph->weight_type;
+	if (graph->weight_type == GRAPH_UNWEIGHTED)
+		return (1);
+
+	csr->weights = malloc((csr->nb_edges + 1) * sizeof(graph_weight_t));
+	if (!csr->weights)
+		return (0);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		pos = csr->offsets[vertex->index];
+		for (edge = vertex->edges; edge; edge = edge->next)
+			csr->weights[pos++] = EDGE_WEIGHT(edge);
+	}
+
+	return (1);
+}
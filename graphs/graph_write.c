@@ -0,0 +1,94 @@
+#include "graphs.h"
+
+/**
+ * graph_write - program that writes the contents of a graph to a buffered
+ * output stream
+ *
+ * the output is exactly the one of graph_display, but it is gathered in
+ * the buffer of @writer and the numbers are formatted without printf, so
+ * dumping a large graph is bound by the speed of the output device
+ *
+ * @graph: pointer to the graph to write
+ * @writer: pointer to the stream to write to
+ *
+ * Return: 1 on success, 0 if a write has failed on the stream
+ */
+
+int graph_write(const graph_t *graph, graph_writer_t *writer)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+
+	graph_writer_put(writer, "Number of vertices: ", 20);
+	graph_writer_ulong(writer, graph->nb_vertices);
+	graph_writer_put(writer, "\n", 1);
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		graph_writer_put(writer, "[", 1);
+		graph_writer_ulong(writer, vertex->index);
+		graph_writer_put(writer, "] ", 2);
+		graph_writer_put(writer, vertex->content,
+				 strlen(vertex->content));
+		if (vertex->edges)
+			graph_writer_put(writer, " ->", 3);
+
+		for (edge = vertex->edges; edge; edge = edge->next)
+		{
+			if (edge->dest)
+				graph_writer_ulong(writer, edge->dest->index);
+			else
+				graph_writer_put(writer, "nil", 3);
+			if (edge->next)
+				graph_writer_put(writer, "->", 2);
+		}
+		graph_writer_put(writer, "\n", 1);
+	}
+
+	return (!writer->error);
+}
+
+
+
+/**
+ * graph_csr_write - program that writes the contents of a CSR snapshot to
+ * a buffered output stream
+ *
+ * the output is exactly the one of graph_csr_display
+ *
+ * @csr: pointer to the snapshot to write
+ * @writer: pointer to the stream to write to
+ *
+ * Return: 1 on success, 0 if a write has failed on the stream
+ */
+
+int graph_csr_write(const graph_csr_t *csr, graph_writer_t *writer)
+{
+	const char *content;
+	size_t v, i;
+
+	graph_writer_put(writer, "Number of vertices: ", 20);
+	graph_writer_ulong(writer, csr->nb_vertices);
+	graph_writer_put(writer, "\n", 1);
+
+	for (v = 0; v < csr->nb_vertices; v++)
+	{
+		content = graph_csr_content(csr, v);
+		graph_writer_put(writer, "[", 1);
+		graph_writer_ulong(writer, v);
+		graph_writer_put(writer, "] ", 2);
+		graph_writer_put(writer, content, strlen(content));
+		if (csr->offsets[v] < csr->offsets[v + 1])
+			graph_writer_put(writer, " ->", 3);
+
+		for (i = csr->offsets[v]; i < csr->offsets[v + 1]; i++)
+		{
+			graph_writer_ulong(writer, csr->targets[i]);
+			if (i + 1 < csr->offsets[v + 1])
+				graph_writer_put(writer, "->", 2);
+		}
+		graph_writer_put(writer, "\n", 1);
+	}
+
+	return (!writer->error);
+}
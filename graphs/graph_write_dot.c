@@ -0,0 +1,125 @@
+#include "graphs.h"
+
+/**
+ * dot_write_label - program that writes a string as a quoted DOT string
+ *
+ * double quotes and backslashes are escaped, and newlines turned into
+ * the \n escape sequence of DOT labels
+ *
+ * @writer: pointer to the stream to write to
+ * @str: the string to write
+ *
+ * Return: nothing (void)
+ */
+
+void dot_write_label(graph_writer_t *writer, const char *str)
+{
+	size_t len;
+
+	graph_writer_put(writer, "\"", 1);
+	while (*str)
+	{
+		len = strcspn(str, "\"\\\n");
+		graph_writer_put(writer, str, len);
+		str += len;
+		if (!*str)
+			break;
+		if (*str == '\n')
+			graph_writer_put(writer, "\\n", 2);
+		else
+		{
+			graph_writer_put(writer, "\\", 1);
+			graph_writer_put(writer, str, 1);
+		}
+		str++;
+	}
+	graph_writer_put(writer, "\"", 1);
+}
+
+
+
+/**
+ * dot_write_weight - program that writes the weight of an edge as a DOT
+ * edge label
+ *
+ * @writer: pointer to the stream to write to
+ * @graph: the weighted graph the edge belongs to
+ * @edge: the edge
+ *
+ * Return: nothing (void)
+ */
+
+void dot_write_weight(graph_writer_t *writer, const graph_t *graph,
+		      const edge_t *edge)
+{
+	char number[32];
+	unsigned long magnitude;
+	long weight;
+
+	graph_writer_put(writer, " [label=\"", 9);
+	if (graph->weight_type == GRAPH_WEIGHT_DOUBLE)
+		graph_writer_put(writer, number,
+				 sprintf(number, "%g", EDGE_WEIGHT(edge).d));
+	else
+	{
+		weight = EDGE_WEIGHT(edge).l;
+		magnitude = (unsigned long)weight;
+		if (weight < 0)
+		{
+			graph_writer_put(writer, "-", 1);
+			magnitude = -magnitude;
+		}
+		graph_writer_ulong(writer, magnitude);
+	}
+	graph_writer_put(writer, "\"]", 2);
+}
+
+
+
+/**
+ * graph_write_dot - program that exports a graph in the DOT language of
+ * GraphViz
+ *
+ * the graph is written as a digraph whose nodes are named after the
+ * indices of the vertices and labeled with their contents; a bidirectional
+ * edge shows up as two opposite edges, and the edges of a weighted graph
+ * are labeled with their weight
+ *
+ * @graph: pointer to the graph to export
+ * @writer: pointer to the stream to write to
+ *
+ * Return: 1 on success, 0 if a write has failed on the stream
+ */
+
+int graph_write_dot(const graph_t *graph, graph_writer_t *writer)
+{
+	vertex_t *vertex;
+	edge_t *edge;
+
+	graph_writer_put(writer, "digraph {\n", 10);
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		graph_writer_put(writer, "\t", 1);
+		graph_writer_ulong(writer, vertex->index);
+		graph_writer_put(writer, " [label=", 8);
+		dot_write_label(writer, vertex->content);
+		graph_writer_put(writer, "];\n", 3);
+	}
+
+	for (vertex = graph->vertices; vertex; vertex = vertex->next)
+	{
+		for (edge = vertex->edges; edge; edge = edge->next)
+		{
+			graph_writer_put(writer, "\t", 1);
+			graph_writer_ulong(writer, vertex->index);
+			graph_writer_put(writer, " -> ", 4);
+			graph_writer_ulong(writer, edge->dest->index);
+			if (graph->weight_type != GRAPH_UNWEIGHTED)
+				dot_write_weight(writer, graph, edge);
+			graph_writer_put(writer, ";\n", 2);
+		}
+	}
+	graph_writer_put(writer, "}\n", 2);
+
+	return (!writer->error);
+}
@@ -0,0 +1,177 @@
+#include "graphs.h"
+
+/**
+ * graph_writer_init - program that sets up a buffered output stream
+ *
+ * @writer: a pointer to the stream to set up
+ * @file: the stdio stream to write to, or NULL to write to @fd
+ * @fd: the file descriptor to write to when @file is NULL
+ * @buffer: a buffer of @size bytes to gather the output in, or NULL to
+ * have one allocated, which is then reused until graph_writer_clear
+ * @size: the size of @buffer, which must not be 0 when @buffer is given;
+ * 0 when @buffer is NULL to allocate GRAPH_WRITER_BUFFER bytes
+ *
+ * Return: 1 on success, 0 if memory allocation fails or @buffer is given
+ * without its size, in which case the stream is left failed and the
+ * output written to it is dropped
+ */
+
+int graph_writer_init(graph_writer_t *writer, FILE *file, int fd,
+		      char *buffer, size_t size)
+{
+	writer->file = file;
+	writer->fd = fd;
+	writer->size = size ? size : GRAPH_WRITER_BUFFER;
+	writer->len = 0;
+	writer->owned = !buffer;
+	writer->buffer = NULL;
+	if (!buffer || size)
+		writer->buffer = buffer ? buffer : malloc(writer->size);
+
+/* A stream without buffer is failed, writing to it does nothing */
+	writer->error = !writer->buffer;
+	return (writer->buffer != NULL);
+}
+
+
+
+/**
+ * graph_writer_flush - program that hands the pending output of a buffered
+ * output stream to its file or file descriptor
+ *
+ * partial writes are resumed, and writes interrupted by a signal retried
+ *
+ * @writer: a pointer to the stream
+ *
+ * Return: 1 on success, 0 if a write has failed on this stream
+ */
+
+int graph_writer_flush(graph_writer_t *writer)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	if (writer->error || !writer->len)
+	{
+		writer->len = 0;
+		return (!writer->error);
+	}
+
+	if (writer->file)
+		writer->error = fwrite(writer->buffer, 1, writer->len,
+				       writer->file) != writer->len;
+	while (!writer->file && done < writer->len)
+	{
+		n = write(writer->fd, writer->buffer + done,
+			  writer->len - done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+		{
+			writer->error = 1;
+			break;
+		}
+		done += n;
+	}
+
+	writer->len = 0;
+	return (!writer->error);
+}
+
+
+
+/**
+ * graph_writer_put - program that appends bytes to a buffered output stream
+ *
+ * @writer: a pointer to the stream
+ * @str: the bytes to append
+ * @len: the number of bytes to append
+ *
+ * Return: nothing (void)
+ */
+
+void graph_writer_put(graph_writer_t *writer, const char *str, size_t len)
+{
+	size_t chunk;
+
+	if (!writer->buffer)
+		return;
+	while (len)
+	{
+		if (writer->len == writer->size)
+			graph_writer_flush(writer);
+		chunk = writer->size - writer->len;
+		if (chunk > len)
+			chunk = len;
+		memcpy(writer->buffer + writer->len, str, chunk);
+		writer->len += chunk;
+		str += chunk;
+		len -= chunk;
+	}
+}
+
+
+
+/**
+ * graph_writer_ulong - program that appends the decimal representation of
+ * a number to a buffered output stream
+ *
+ * the digits are produced two at a time from a table, from the right end
+ * of a small local buffer, which is much cheaper than going through the
+ * format parsing of printf
+ *
+ * @writer: a pointer to the stream
+ * @n: the number to append
+ *
+ * Return: nothing (void)
+ */
+
+void graph_writer_ulong(graph_writer_t *writer, unsigned long n)
+{
+	static const char pairs[] =
+		"00010203040506070809101112131415161718192021222324"
+		"25262728293031323334353637383940414243444546474849"
+		"50515253545556575859606162636465666768697071727374"
+		"75767778798081828384858687888990919293949596979899";
+	char digits[24], *p = digits + sizeof(digits);
+
+	while (n >= 100)
+	{
+		p -= 2;
+		memcpy(p, pairs + (n % 100) * 2, 2);
+		n /= 100;
+	}
+	if (n >= 10)
+	{
+		p -= 2;
+		memcpy(p, pairs + n * 2, 2);
+	}
+	else
+		*--p = (char)('0' + n);
+
+	graph_writer_put(writer, p, digits + sizeof(digits) - p);
+}
+
+
+
+/**
+ * graph_writer_clear - program that flushes a buffered output stream and
+ * releases its buffer if it allocated it
+ *
+ * the file or file descriptor itself is neither flushed nor closed
+ *
+ * @writer: a pointer to the stream
+ *
+ * Return: 1 if all the output was written, 0 otherwise
+ */
+
+int graph_writer_clear(graph_writer_t *writer)
+{
+	int ok = graph_writer_flush(writer);
+
+	if (writer->owned)
+		free(writer->buffer);
+	writer->buffer = NULL;
+	writer->size = 0;
+	return (ok);
+}
@@ -4,7 +4,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
 
 
 
@@ -46,6 +54,113 @@ typedef struct edge_s
 
 
 
+/**
+ * enum graph_weight_type_e - Enumerates the kinds of weights the edges
+ * of a graph can carry
+ *
+ * @GRAPH_UNWEIGHTED: The edges carry no weight
+ * @GRAPH_WEIGHT_INT: The edges carry an integer weight, in member l
+ *   of graph_weight_t
+ * @GRAPH_WEIGHT_DOUBLE: The edges carry a floating-point weight, in member d
+ *   of graph_weight_t
+ */
+
+typedef enum graph_weight_type_e
+{
+	GRAPH_UNWEIGHTED = 0,
+	GRAPH_WEIGHT_INT,
+	GRAPH_WEIGHT_DOUBLE
+} graph_weight_type_t;
+
+
+
+/**
+ * union graph_weight_u - Weight of an edge
+ *
+ * @l: Integer weight, for GRAPH_WEIGHT_INT graphs
+ * @d: Floating-point weight, for GRAPH_WEIGHT_DOUBLE graphs
+ */
+
+typedef union graph_weight_u
+{
+	long        l;
+	double      d;
+} graph_weight_t;
+
+
+
+/**
+ * struct weighted_edge_s - Node in the linked list of edges of a vertex of
+ * a weighted graph
+ *
+ * The edge_t comes first, so a weighted edge is linked, walked and freed
+ * through a plain edge_t pointer, and its weight is read in place with
+ * EDGE_WEIGHT, without any lookup.
+ *
+ * @edge: The edge itself
+ * @weight: The weight of the edge
+ */
+
+typedef struct weighted_edge_s
+{
+	edge_t      edge;
+	graph_weight_t  weight;
+} weighted_edge_t;
+
+/*
+ * Weight of an edge, given as an edge_t pointer; only valid when the
+ * weight_type of the graph of the edge is not GRAPH_UNWEIGHTED, since the
+ * edges of an unweighted graph have no room for a weight: check it first,
+ * or use graph_get_edge_weight
+ */
+#define EDGE_WEIGHT(e) (((weighted_edge_t *)(e))->weight)
+
+
+
+/**
+ * struct edge_link_s - Links kept at the end of every edge node of a graph
+ * maintaining its reverse adjacency (see graph_track_reverse)
+ *
+ * They make the edge lists and the in_edges lists doubly linked, and pair
+ * each edge with its reverse adjacency node, so that an edge is unlinked
+ * from both lists in constant time.
+ *
+ * @prev: Pointer to the previous node of the list, NULL for the head
+ * @twin: Pointer to the reverse adjacency node of an edge, or to the edge
+ *   of a reverse adjacency node
+ */
+
+typedef struct edge_link_s
+{
+	edge_t      *prev;
+	edge_t      *twin;
+} edge_link_t;
+
+
+
+/**
+ * struct in_edge_s - Node in the linked list of the edges leading to
+ * a vertex, whose dest member points to their source vertex
+ *
+ * @edge: The node itself
+ * @link: The links of the node
+ */
+
+typedef struct in_edge_s
+{
+	edge_t      edge;
+	edge_link_t link;
+} in_edge_t;
+
+/* Links of an edge of a graph maintaining its reverse adjacency */
+#define EDGE_LINK(graph, e) \
+	((edge_link_t *)((char *)(e) + graph_edge_size(graph)) - 1)
+
+/* Links of a node of an in_edges list, given as an edge_t pointer */
+#define IN_EDGE_LINK(e) (&((in_edge_t *)(e))->link)
+
+
+
 /**
  * struct vertex_s - Node in the linked list of vertices in the adjacency list
  *
@@ -53,9 +168,15 @@ typedef struct edge_s
  * @content: Custom data stored in the vertex (here, a string)
  * @nb_edges: Number of connections with other vertices in the graph
  * @edges: Pointer to the head node of the linked list of edges
+ * @edges_tail: Pointer to the last node of the linked list of edges,
+ *   so that new edges are appended in constant time
+ * @in_edges: Pointer to the head node of the linked list of the edges
+ *   leading to this vertex, whose nodes are in_edge_t; only maintained
+ *   once graph_track_reverse was called on the graph
  * @next: Pointer to the next vertex in the adjacency linked list
  *   This pointer points to another vertex in the graph, but it
  *   doesn't stand for an edge between the two vertices
+ * @prev: Pointer to the previous vertex in the adjacency linked list
  */
 
 struct vertex_s
@@ -64,11 +185,147 @@ struct vertex_s
 	char        *content;
 	size_t      nb_edges;
 	edge_t      *edges;
+	edge_t      *edges_tail;
+	edge_t      *in_edges;
 	struct vertex_s *next;
+	struct vertex_s *prev;
 };
 
 
 
+/**
+ * struct vertex_slot_s - Slot of the vertex hash index
+ *
+ * @hash: Hash of the content of the stored vertex
+ * @vertex: Pointer to the stored vertex, NULL if the slot is empty
+ */
+
+typedef struct vertex_slot_s
+{
+	size_t      hash;
+	vertex_t    *vertex;
+} vertex_slot_t;
+
+
+
+/**
+ * struct vertex_index_s - Open-addressing hash index of the vertices
+ *
+ * Maps the content string of a vertex to the vertex itself, using
+ * linear probing over a power-of-two table of slots
+ *
+ * @slots: Table of slots, NULL until the first vertex is inserted
+ * @capacity: Number of slots in the table (0 or a power of two)
+ * @size: Number of vertices stored in the table
+ */
+
+typedef struct vertex_index_s
+{
+	vertex_slot_t   *slots;
+	size_t      capacity;
+	size_t      size;
+} vertex_index_t;
+
+
+
+/**
+ * struct edge_slot_s - Slot of the edge hash set of a graph
+ *
+ * @src: Source vertex of the edges of the slot, NULL for an empty slot
+ * @dest: Destination vertex of the edges of the slot
+ * @edge: One of the edges from @src to @dest
+ * @count: Number of parallel edges from @src to @dest
+ */
+
+typedef struct edge_slot_s
+{
+	const vertex_t  *src;
+	const vertex_t  *dest;
+	edge_t      *edge;
+	size_t      count;
+} edge_slot_t;
+
+
+
+/**
+ * struct edge_set_s - Open-addressing hash set of the edges of a graph
+ *
+ * Maps a pair of vertices to the edges between them, using linear probing
+ * over a power-of-two table of slots, so that whether an edge exists is
+ * known without walking an edge list
+ *
+ * @slots: Table of slots, NULL until the first edge is inserted
+ * @capacity: Number of slots in the table (0 or a power of two)
+ * @size: Number of pairs of vertices stored in the table
+ */
+
+typedef struct edge_set_s
+{
+	edge_slot_t *slots;
+	size_t      capacity;
+	size_t      size;
+} edge_set_t;
+
+
+
+/**
+ * struct graph_slab_s - Header of a block of memory owned by a graph
+ *
+ * The memory handed out by the slab immediately follows this header.
+ * Objects allocated from a slab are never freed on their own, they are
+ * all released at once with the slab when the graph is deleted.
+ *
+ * @next: Pointer to the next slab owned by the graph
+ * @size: Number of bytes following the header
+ * @used: Number of these bytes already handed out
+ */
+
+typedef struct graph_slab_s
+{
+	struct graph_slab_s *next;
+	size_t      size;
+	size_t      used;
+} graph_slab_t;
+
+
+
+/* Alignment of the objects allocated from a graph_slab_t */
+#define GRAPH_SLAB_ALIGN 8
+
+/* Size of the memory blocks of a graph created with graph_create_arena */
+#define GRAPH_ARENA_CHUNK (1UL << 20)
+
+
+
+/**
+ * struct graph_counters_s - Profiling counters of a graph
+ *
+ * Once attached to a graph with graph_set_counters, the counters are
+ * incremented by the traversals and the allocations of the graph; they
+ * are never reset by the library.
+ *
+ * @vertices_visited: Number of vertices visited by traversals
+ * @edges_scanned: Number of edges examined by traversals
+ * @allocations: Number of memory allocations made for the graph and
+ *   by its traversals
+ */
+
+typedef struct graph_counters_s
+{
+	size_t      vertices_visited;
+	size_t      edges_scanned;
+	size_t      allocations;
+} graph_counters_t;
+
+/* Add @n to a counter of a graph, if the graph has counters attached */
+#define GRAPH_COUNT(graph, counter, n) \
+	do { \
+		if ((graph)->counters) \
+			(graph)->counters->counter += (n); \
+	} while (0)
+
+
+
 /**
  * struct graph_s - Representation of a graph
  *
@@ -76,55 +333,724 @@ struct vertex_s
  *
  * @nb_vertices: Number of vertices in our graph
  * @vertices: Pointer to the head node of our adjacency linked list
+ * @vertices_tail: Pointer to the last node of our adjacency linked list,
+ *   so that new vertices are appended in constant time
+ * @lookup: Hash index of the vertices, keyed by their content
+ * @slabs: Pointer to the head node of the linked list of memory blocks
+ *   owned by the graph, such as the edges inserted by batches
+ * @slab_table: Array of the @nb_slabs memory blocks owned by the graph,
+ *   sorted by address, so that graph_slab_owns is a binary search;
+ *   the blocks of an arena graph are not recorded in it
+ * @nb_slabs: Number of memory blocks recorded in @slab_table
+ * @slab_capacity: Number of memory blocks @slab_table can hold
+ * @arena: 1 if all the vertices, edges and contents of the graph are
+ *   allocated from its memory blocks (see graph_create_arena), 0 otherwise
+ * @reverse: 1 if the in_edges lists of the vertices are maintained, and
+ *   the edges end with an edge_link_t (see graph_track_reverse), 0 otherwise
+ * @vertex_table: Array of @table_capacity vertex pointers, in which the
+ *   vertex of index i is stored at position i
+ * @table_capacity: Number of vertex pointers @vertex_table can hold
+ * @weight_type: Kind of weight carried by the edges; the edges of
+ *   a weighted graph are weighted_edge_t (see graph_set_weight_type)
+ * @counters: Pointer to the profiling counters of the graph, NULL if none
+ * @edge_set: Pointer to the hash set of the edges of the graph, NULL if it
+ *   is not maintained (see graph_track_edges)
+ * @unique_edges: 1 if inserting an edge that already exists leaves the
+ *   graph unchanged (see graph_set_unique_edges), 0 otherwise
  */
 
 typedef struct graph_s
 {
 	size_t      nb_vertices;
 	vertex_t    *vertices;
+	vertex_t    *vertices_tail;
+	vertex_index_t  lookup;
+	graph_slab_t    *slabs;
+	graph_slab_t    **slab_table;
+	size_t      nb_slabs;
+	size_t      slab_capacity;
+	int     arena;
+	int     reverse;
+	vertex_t    **vertex_table;
+	size_t      table_capacity;
+	graph_weight_type_t weight_type;
+	graph_counters_t    *counters;
+	edge_set_t  *edge_set;
+	int     unique_edges;
 } graph_t;
 
 
 
+/* Number of buckets of a degree histogram, see graph_stats_t */
+#define GRAPH_DEGREE_BUCKETS (sizeof(size_t) * 8 + 1)
+
+
+
+/**
+ * struct graph_stats_s - Statistics of a graph
+ *
+ * The bucket 0 of @degrees counts the vertices without edges, and the
+ * bucket k the vertices with 2^(k - 1) up to 2^k - 1 edges.
+ * The memory footprint is split by category; objects allocated from the
+ * blocks of the graph are counted in their category, and @block_bytes
+ * is the total size of the blocks, used or not.
+ *
+ * @nb_vertices: Number of vertices
+ * @nb_edges: Number of edges
+ * @max_degree: Highest number of edges leaving a vertex
+ * @avg_degree: Average number of edges leaving a vertex, which is the
+ *   average length of the adjacency lists
+ * @degrees: Histogram of the number of edges leaving each vertex
+ * @vertex_bytes: Memory used by the vertices and the table of vertices
+ * @edge_bytes: Memory used by the edges and the reverse adjacency nodes
+ * @string_bytes: Memory used by the contents of the vertices
+ * @index_bytes: Memory used by the vertex hash index and edge hash set
+ * @block_bytes: Memory reserved by the blocks owned by the graph
+ */
+
+typedef struct graph_stats_s
+{
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      max_degree;
+	double      avg_degree;
+	size_t      degrees[GRAPH_DEGREE_BUCKETS];
+	size_t      vertex_bytes;
+	size_t      edge_bytes;
+	size_t      string_bytes;
+	size_t      index_bytes;
+	size_t      block_bytes;
+} graph_stats_t;
+
+
+
+/**
+ * struct graph_csr_s - Frozen, read-only snapshot of a graph
+ *
+ * The vertices and edges are stored in compressed sparse row layout:
+ * the edges of the vertex of index i are the vertex indices stored in
+ * targets[offsets[i]] up to targets[offsets[i + 1] - 1], in the same order
+ * as in the edges linked list of the vertex.
+ * The contents of the vertices are interned back to back in @strings;
+ * they are addressed by offsets rather than pointers so the whole snapshot
+ * stays position-independent.
+ *
+ * @nb_vertices: Number of vertices in the snapshot
+ * @nb_edges: Number of edges in the snapshot
+ * @offsets: Array of nb_vertices + 1 offsets into @targets
+ * @targets: Array of nb_edges destination vertex indices
+ * @contents: Array of nb_vertices offsets into @strings
+ * @strings: Contents of the vertices, each terminated by a null byte
+ * @strings_size: Number of bytes used in @strings
+ * @in_offsets: Array of nb_vertices + 1 offsets into @in_sources,
+ *   NULL until the reverse adjacency is built by graph_csr_add_reverse
+ * @in_sources: Array of nb_edges source vertex indices: the edges leading
+ *   to the vertex of index i come from in_sources[in_offsets[i]] up to
+ *   in_sources[in_offsets[i + 1] - 1]
+ * @mapping: Address of the file mapping the forward arrays and the string
+ *   table point into, NULL if they were allocated by graph_freeze
+ * @mapping_size: Size of @mapping, in bytes
+ * @weight_type: Kind of weight carried by the edges
+ * @weights: Array of nb_edges weights, parallel to @targets, NULL if the
+ *   edges carry no weight; binary graph files do not store it
+ */
+
+typedef struct graph_csr_s
+{
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      *offsets;
+	size_t      *targets;
+	size_t      *contents;
+	char        *strings;
+	size_t      strings_size;
+	size_t      *in_offsets;
+	size_t      *in_sources;
+	void        *mapping;
+	size_t      mapping_size;
+	graph_weight_type_t weight_type;
+	graph_weight_t  *weights;
+} graph_csr_t;
+
+
+
+/* Identification of the binary graph files written by graph_csr_save */
+#define GRAPH_FILE_MAGIC "GRAPHCSR"
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_BYTE_ORDER 0x01020304U
+
+
+
+/**
+ * struct graph_file_header_s - Header of a binary graph file
+ *
+ * The header is followed by the arrays of a CSR snapshot, stored exactly
+ * as in memory so that the file can be mapped and used in place:
+ * offsets (nb_vertices + 1 words), targets (nb_edges words),
+ * contents (nb_vertices words), then the string table (strings_size bytes)
+ *
+ * @magic: GRAPH_FILE_MAGIC, without its null byte
+ * @version: GRAPH_FILE_VERSION
+ * @byte_order: GRAPH_FILE_BYTE_ORDER, as written by the saving machine
+ * @word_size: Size of a size_t on the saving machine
+ * @flags: Reserved, 0
+ * @nb_vertices: Number of vertices in the snapshot
+ * @nb_edges: Number of edges in the snapshot
+ * @strings_size: Number of bytes of the string table
+ */
+
+typedef struct graph_file_header_s
+{
+	char        magic[8];
+	unsigned int    version;
+	unsigned int    byte_order;
+	unsigned int    word_size;
+	unsigned int    flags;
+	size_t      nb_vertices;
+	size_t      nb_edges;
+	size_t      strings_size;
+} graph_file_header_t;
+
+
+
+/**
+ * struct csr_frame_s - Frame of the explicit stack of a CSR depth-first
+ * traversal
+ *
+ * @vertex: Index of the vertex being explored
+ * @edge: Position in the targets array of the next edge to explore
+ */
+
+typedef struct csr_frame_s
+{
+	size_t      vertex;
+	size_t      edge;
+} csr_frame_t;
+
+
+
+/**
+ * struct bfs_frontier_s - State of a direction-optimizing breadth-first
+ * traversal of a CSR snapshot
+ *
+ * Every discovered vertex is appended to @queue, so the vertices of the
+ * level being expanded are queue[head] up to queue[end - 1], and the
+ * vertices of the next level are appended from queue[end] on.
+ *
+ * @queue: Array of nb_vertices vertex indices, in discovery order
+ * @head: Position in @queue of the first vertex of the current level
+ * @tail: Position in @queue where the next discovered vertex is stored
+ * @visited: Bitset of the discovered vertices
+ * @current: Bitset of the vertices of the current level, only filled
+ *   for the levels expanded bottom-up
+ */
+
+typedef struct bfs_frontier_s
+{
+	size_t      *queue;
+	size_t      head;
+	size_t      tail;
+	unsigned long   *visited;
+	unsigned long   *current;
+} bfs_frontier_t;
+
+
+
+/*
+ * Thresholds of the direction-optimizing breadth-first traversal:
+ * a level is expanded bottom-up once the edges leaving the frontier
+ * outnumber 1 / ALPHA of the edges leaving unvisited vertices, and
+ * top-down again once the frontier holds less than 1 / BETA of the vertices
+ */
+#define BFS_HYBRID_ALPHA 14
+#define BFS_HYBRID_BETA 24
+
+
+
+/**
+ * struct edge_spec_s - Description of an edge to insert in a batch
+ *
+ * @src: Content of the source vertex
+ * @dest: Content of the destination vertex
+ * @type: Type of the edge (UNIDIRECTIONAL or BIDIRECTIONAL)
+ */
+
+typedef struct edge_spec_s
+{
+	const char  *src;
+	const char  *dest;
+	edge_type_t type;
+} edge_spec_t;
+
+
+
+/**
+ * struct edge_pair_s - Edge of a batch once its vertices are resolved
+ *
+ * @src: Pointer to the source vertex
+ * @dest: Pointer to the destination vertex
+ */
+
+typedef struct edge_pair_s
+{
+	vertex_t    *src;
+	vertex_t    *dest;
+} edge_pair_t;
+
+
+
+/* Flags of graph_add_edges_batch */
+#define GRAPH_BATCH_DEDUP 1 /* Sort the batch and drop its parallel edges */
+#define GRAPH_BATCH_CREATE 2 /* Create the vertices that do not exist */
+
+
+
+/* Size of the read buffer and of the edge batches of edge list readers */
+#define EDGE_READER_BUFFER (1UL << 22)
+#define EDGE_READER_BATCH 65536
+
+
+
+/**
+ * struct edge_reader_s - State of a streaming edge list reader
+ *
+ * The text is read in large chunks into @buffer and tokenized in place:
+ * the edges of @batch point to vertex contents inside @buffer, so the
+ * batch is flushed before the buffer is refilled.
+ *
+ * @buffer: Buffer of @size + 1 bytes holding the text not parsed yet
+ * @size: Number of bytes of text @buffer can hold
+ * @len: Number of bytes of text currently in @buffer
+ * @batch: Array of EDGE_READER_BATCH edges waiting to be inserted
+ * @count: Number of edges in @batch
+ * @type: Type of the edges read
+ * @header: 0 until the first line is parsed, 1 while the size line of
+ * a Matrix Market file is still to be skipped, 2 afterwards
+ */
+
+typedef struct edge_reader_s
+{
+	char        *buffer;
+	size_t      size;
+	size_t      len;
+	edge_spec_t *batch;
+	size_t      count;
+	edge_type_t type;
+	int     header;
+} edge_reader_t;
+
+
+
+/* Number of shards of the vertex index of a graph_builder_t */
+#define GRAPH_BUILDER_SHARDS 64
+
+
+
+/**
+ * struct builder_shard_s - Shard of the vertex index of a concurrent
+ * graph builder
+ *
+ * @lock: Lock serializing the lookups and insertions in @index
+ * @index: Hash index of the vertices whose content hashes to this shard
+ */
+
+typedef struct builder_shard_s
+{
+	pthread_mutex_t lock;
+	vertex_index_t  index;
+} builder_shard_t;
+
+
+
+/**
+ * struct graph_builder_s - Graph under construction by several threads
+ *
+ * The vertex contents are spread over @shards by the high bits of their
+ * hash, so threads inserting different vertices seldom wait for the same
+ * lock. The edges of a vertex are pushed on its edges list with
+ * a compare-and-swap, without any lock.
+ *
+ * @shards: The shards of the vertex index
+ * @nb_vertices: Number of vertices created, which is also the index
+ *   given to the next one
+ * @graph: The empty graph the builder turns into, whose edges are
+ *   allocated and sized as graph_connect does
+ */
+
+typedef struct graph_builder_s
+{
+	builder_shard_t shards[GRAPH_BUILDER_SHARDS];
+	size_t      nb_vertices;
+	graph_t     *graph;
+} graph_builder_t;
+
+
+
+/* Size of the buffer graph_display and graph_csr_display write through */
+#define GRAPH_WRITER_BUFFER 4096
+
+
+
 /**
- * struct GraphQueueNode - Node structure for a queue in graph traversal
+ * struct graph_writer_s - Buffered output stream
  *
- * This structure represents a single node in a queue used for graph traversal.
- * Each node holds a vertex from the graph, the depth of that vertex in the
- * traversal, and a pointer to the next node in the queue.
+ * Text is appended to @buffer and only handed to the operating system or
+ * to stdio when the buffer is full or flushed, so dumping a graph costs
+ * a few large writes instead of several small printf calls per edge.
  *
- * @vertex: Pointer to the vertex associated with this node
- * @depth: The depth of the vertex in the traversal from the starting point
- * @next: Pointer to the next node in the queue
+ * @file: Stream to write to, NULL to write to @fd
+ * @fd: File descriptor to write to when @file is NULL
+ * @buffer: Buffer the output is gathered in
+ * @size: Size of @buffer, in bytes
+ * @len: Number of bytes waiting in @buffer
+ * @owned: 1 if @buffer was allocated by graph_writer_init, 0 otherwise
+ * @error: 1 once a write has failed, after which the output is dropped
  */
 
-typedef struct GraphQueueNode
+typedef struct graph_writer_s
 {
-    vertex_t *vertex;
-    size_t depth;
-    struct GraphQueueNode *next;
-} GraphQueueNode;
+	FILE        *file;
+	int     fd;
+	char        *buffer;
+	size_t      size;
+	size_t      len;
+	int     owned;
+	int     error;
+} graph_writer_t;
+
+
+
+/* Depth reported for the vertices a traversal could not reach */
+#define GRAPH_UNREACHED ((size_t)-1)
+
+/* Number of frontier vertices a thread claims or publishes at once */
+#define PARALLEL_BFS_CHUNK 256
+
+
+
+/**
+ * struct parallel_bfs_s - Shared state of a multithreaded breadth-first
+ * traversal of a CSR snapshot
+ *
+ * The threads expand the current level together: they claim chunks of
+ * @frontier through @cursor, discover vertices with an atomic test-and-set
+ * on @visited, and publish them in @next through @next_size.
+ * Between two levels, a single thread swaps @frontier and @next.
+ *
+ * @csr: The traversed snapshot
+ * @visited: Bitset of the discovered vertices
+ * @depths: Array of nb_vertices depths, GRAPH_UNREACHED if not discovered
+ * @frontier: Array of the vertices of the current level
+ * @frontier_size: Number of vertices in @frontier
+ * @next: Array of the vertices discovered for the next level
+ * @next_size: Number of vertices in @next
+ * @cursor: Position in @frontier of the next chunk to claim
+ * @depth: Depth of the current level
+ * @barrier: Barrier the threads meet at between two levels
+ * @start_lock: Lock holding the threads back until @barrier is ready
+ */
+
+typedef struct parallel_bfs_s
+{
+	const graph_csr_t   *csr;
+	unsigned long   *visited;
+	size_t      *depths;
+	size_t      *frontier;
+	size_t      frontier_size;
+	size_t      *next;
+	size_t      next_size;
+	size_t      cursor;
+	size_t      depth;
+	pthread_barrier_t   barrier;
+	pthread_mutex_t start_lock;
+} parallel_bfs_t;
+
+
+
+/**
+ * struct parallel_bfs_local_s - Private state of a thread taking part in
+ * a multithreaded breadth-first traversal
+ *
+ * @bfs: Pointer to the shared state of the traversal
+ * @count: Number of vertices in @buffer
+ * @buffer: Vertices discovered by the thread and not yet published
+ */
+
+typedef struct parallel_bfs_local_s
+{
+	parallel_bfs_t  *bfs;
+	size_t      count;
+	size_t      buffer[PARALLEL_BFS_CHUNK];
+} parallel_bfs_local_t;
+
+
+
+/**
+ * struct dfs_frame_s - Frame of the explicit stack of a depth-first
+ * traversal
+ *
+ * @vertex: Pointer to the vertex being explored
+ * @edge: Pointer to the next edge of @vertex to explore
+ */
+
+typedef struct dfs_frame_s
+{
+	vertex_t    *vertex;
+	edge_t      *edge;
+} dfs_frame_t;
 
 
 
 /**
- * struct GraphQueue - Queue structure for managing nodes in graph traversal
+ * struct dfs_stack_s - Growable stack of depth-first traversal frames
+ *
+ * The depth of the vertex of the top frame is @size - 1
  *
- * This structure represents a queue used for breadth-first traversal of a graph.
- * It keeps track of the front and rear of the queue (head and tail), as well as
- * the total number of nodes currently in the queue. This queue is used to
- * manage the order in which vertices are visited during the traversal.
+ * @frames: Array of frames, the top of the stack is the last one
+ * @size: Number of frames currently in the stack
+ * @capacity: Number of frames the array can hold before growing
+ * @counters: Profiling counters the growths of @frames are counted in as
+ *   allocations, NULL if none
+ */
+
+typedef struct dfs_stack_s
+{
+	dfs_frame_t *frames;
+	size_t      size;
+	size_t      capacity;
+	graph_counters_t    *counters;
+} dfs_stack_t;
+
+
+
+/**
+ * enum dfs_action_e - Enumerates what the callbacks of a dfs_visitor_t can
+ * ask the depth-first traversal engine to do next
  *
- * @head: Pointer to the first node in the queue
- * @tail: Pointer to the last node in the queue
- * @size: The number of nodes currently in the queue
+ * @DFS_CONTINUE: Carry on with the traversal
+ * @DFS_PRUNE: Do not explore the edges of the vertex just discovered, or do
+ *   not follow the tree edge just classified
+ * @DFS_STOP: Abort the whole traversal
+ */
+
+typedef enum dfs_action_e
+{
+	DFS_CONTINUE = 0,
+	DFS_PRUNE,
+	DFS_STOP
+} dfs_action_t;
+
+
+
+/**
+ * enum dfs_edge_kind_e - Enumerates the classes of the edges met during
+ * a depth-first traversal
+ *
+ * @DFS_TREE_EDGE: The edge leads to an undiscovered vertex
+ * @DFS_BACK_EDGE: The edge leads to a vertex being explored, an ancestor
+ *   of its source or its source itself, so it closes a cycle
+ * @DFS_FORWARD_EDGE: The edge leads to an explored descendant of its source
+ * @DFS_CROSS_EDGE: The edge leads to an explored vertex that is not
+ *   a descendant of its source
+ */
+
+typedef enum dfs_edge_kind_e
+{
+	DFS_TREE_EDGE = 0,
+	DFS_BACK_EDGE,
+	DFS_FORWARD_EDGE,
+	DFS_CROSS_EDGE
+} dfs_edge_kind_t;
+
+
+
+/**
+ * struct dfs_visitor_s - Callbacks of the depth-first traversal engine
+ *
+ * Any callback can be NULL. The depth of a vertex is the number of tree
+ * edges between it and the root of its tree.
+ *
+ * @pre: Called when a vertex is discovered, before its edges are explored
+ * @post: Called when all the edges of a vertex have been explored
+ * @edge: Called for every edge explored, with its class, before following
+ *   it if it is a tree edge
+ * @data: Pointer handed to every callback
+ */
+
+typedef struct dfs_visitor_s
+{
+	dfs_action_t (*pre)(const vertex_t *v, size_t depth, void *data);
+	dfs_action_t (*post)(const vertex_t *v, size_t depth, void *data);
+	dfs_action_t (*edge)(const vertex_t *src, const vertex_t *dest,
+			     dfs_edge_kind_t kind, void *data);
+	void        *data;
+} dfs_visitor_t;
+
+
+
+/**
+ * struct dfs_engine_s - State of a traversal of the depth-first traversal
+ * engine
+ *
+ * @visitor: The callbacks of the traversal
+ * @order: Array of the discovery rank of each vertex, starting at 1,
+ *   0 for the vertices not discovered yet
+ * @finished: Bitset of the vertices whose edges have all been explored
+ * @counter: Discovery rank of the last discovered vertex
+ * @stack: Explicit stack of the vertices being explored
+ * @counters: Profiling counters of the traversed graph, or NULL
+ */
+
+typedef struct dfs_engine_s
+{
+	const dfs_visitor_t *visitor;
+	size_t      *order;
+	unsigned long   *finished;
+	size_t      counter;
+	dfs_stack_t stack;
+	graph_counters_t    *counters;
+} dfs_engine_t;
+
+
+
+/**
+ * struct topo_iter_s - Iterator over the ready sets of a graph whose edges
+ * stand for dependencies, an edge leading from a vertex to a vertex that
+ * depends on it
+ *
+ * Every vertex enters @ready once, when its last dependency is released,
+ * so the batches follow each other in a single array.
+ *
+ * @graph: The iterated graph
+ * @in_degree: Array of the number of unreleased edges leading to each
+ *   vertex, indexed by vertex index
+ * @ready: Array of nb_vertices vertex pointers, listing the vertices in
+ *   the order they became ready
+ * @start: Position in @ready of the first vertex of the current batch
+ * @end: Position in @ready following the last vertex of the current batch
+ * @tail: Number of vertices in @ready
+ */
+
+typedef struct topo_iter_s
+{
+	const graph_t   *graph;
+	size_t      *in_degree;
+	vertex_t    **ready;
+	size_t      start;
+	size_t      end;
+	size_t      tail;
+} topo_iter_t;
+
+
+
+/**
+ * struct cycle_search_s - State of a cycle search, run by the depth-first
+ * traversal engine
+ *
+ * @path: Array of the indices of the vertices from the root of the current
+ *   tree to the vertex being explored
+ * @size: Number of vertices in @path
+ * @start: Position in @path of the first vertex of the cycle, once found
+ */
+
+typedef struct cycle_search_s
+{
+	size_t      *path;
+	size_t      size;
+	size_t      start;
+} cycle_search_t;
+
+
+
+/* Component of the vertices Tarjan's algorithm has not assigned yet */
+#define GRAPH_NO_COMPONENT ((size_t)-1)
+
+
+
+/**
+ * struct tarjan_s - State of Tarjan's strongly connected components
+ * algorithm
+ *
+ * A vertex is on the stack of Tarjan's algorithm while it has been
+ * discovered (non-zero @order) but not assigned a component yet.
+ *
+ * @order: Array of the discovery rank of each vertex, starting at 1,
+ *   0 for the vertices not discovered yet
+ * @low: Array of the lowest discovery rank reachable from each vertex
+ *   through its DFS subtree and one edge to a vertex on the stack
+ * @stack: Array of the vertices waiting for their component
+ * @stack_size: Number of vertices in @stack
+ * @counter: Discovery rank of the last discovered vertex
+ * @labels: Array of the component of each vertex
+ * @nb_components: Number of components assigned so far
+ * @dfs: Explicit stack of the depth-first traversal
+ */
+
+typedef struct tarjan_s
+{
+	size_t      *order;
+	size_t      *low;
+	size_t      *stack;
+	size_t      stack_size;
+	size_t      counter;
+	size_t      *labels;
+	size_t      nb_components;
+	dfs_stack_t dfs;
+} tarjan_t;
+
+
+
+/**
+ * struct parallel_components_s - Shared state of a multithreaded weakly
+ * connected components labeling of a CSR snapshot
+ *
+ * @csr: The labeled snapshot
+ * @parent: Union-find forest, every vertex pointing to a vertex of lower
+ *   or equal index, the roots pointing to themselves
+ * @cursor: Index of the next chunk of vertices to claim
+ */
+
+typedef struct parallel_components_s
+{
+	const graph_csr_t   *csr;
+	size_t      *parent;
+	size_t      cursor;
+} parallel_components_t;
+
+
+
+/* Bit-packed sets of vertex indices, stored in arrays of unsigned long */
+#define BITSET_BITS (sizeof(unsigned long) * 8)
+#define BITSET_WORDS(n) (((n) + BITSET_BITS - 1) / BITSET_BITS)
+#define BITSET_TEST(set, i) \
+	(((set)[(i) / BITSET_BITS] >> ((i) % BITSET_BITS)) & 1UL)
+#define BITSET_SET(set, i) \
+	((set)[(i) / BITSET_BITS] |= 1UL << ((i) % BITSET_BITS))
+
+
+
+/**
+ * struct GraphQueue - Queue structure for managing vertices in graph traversal
+ *
+ * This structure represents the queue used for breadth-first traversal of a
+ * graph, as a ring buffer over a single contiguous array of vertex pointers.
+ * Each vertex is enqueued at most once during a traversal, so the array is
+ * sized once from the number of vertices of the graph and never grows.
+ * The depth of the vertices is not stored, the traversal deduces it from
+ * the number of vertices enqueued for each level.
+ *
+ * @vertices: Array of @capacity vertex pointers
+ * @capacity: Maximum number of vertices the queue can hold
+ * @head: Position in @vertices of the first vertex in the queue
+ * @size: The number of vertices currently in the queue
  */
 
 typedef struct GraphQueue
 {
-    GraphQueueNode *head;
-    GraphQueueNode *tail;
-    size_t size;
+	vertex_t    **vertices;
+	size_t      capacity;
+	size_t      head;
+	size_t      size;
 } GraphQueue;
 
 
@@ -135,10 +1061,14 @@ void graph_display(const graph_t *graph);
 graph_t *graph_create(void);
 
 /* task 1. Add a vertex */
+int graph_reserve_vertex(graph_t *graph);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
 
 /* task 2. Add an edge */
+void vertex_link_edge(vertex_t *src_vertex, edge_t *edge);
 edge_t *graph_add_single_edge(vertex_t *src_vertex, vertex_t *dest_vertex);
+edge_t *graph_connect(graph_t *graph, vertex_t *src_vertex,
+		      vertex_t *dest_vertex);
 int graph_add_edge(graph_t *graph, const char *src,
 		   const char *dest, edge_type_t type);
 
@@ -146,20 +1076,233 @@ int graph_add_edge(graph_t *graph, const char *src,
 void graph_delete(graph_t *graph);
 
 /* task 4. Depth-first traversal */
-size_t traverseVerticesRecursively(vertex_t *vertex, char *visited_flags,
-				   size_t current_depth, void (*vertex_action)
-				   (const vertex_t *v, size_t depth));
+int dfs_stack_push(dfs_stack_t *stack, vertex_t *vertex);
 size_t depth_first_traverse(const graph_t *graph, void (*action)
 			    (const vertex_t *v, size_t depth));
 
 /* task 5. Breadth-first traversal */
 void freeQueue(GraphQueue *queue);
-int pushToQueue(GraphQueue *queue, vertex_t *vertex, size_t depth);
-int popFromQueue(GraphQueue *queue, vertex_t **vertex, size_t *depth);
-void processEdges(GraphQueue *queue, const vertex_t *vertex, size_t currentDepth,
-		  size_t *visited);
+int pushToQueue(GraphQueue *queue, vertex_t *vertex);
+int popFromQueue(GraphQueue *queue, vertex_t **vertex);
+void processEdges(GraphQueue *queue, const vertex_t *vertex,
+		  unsigned long *visited);
 size_t breadth_first_traverse(const graph_t *graph, void (*action)
 			      (const vertex_t *v, size_t depth));
 
+/* vertex hash index */
+size_t vertex_index_hash(const char *str);
+int vertex_index_grow(vertex_index_t *index);
+int vertex_index_insert(vertex_index_t *index, vertex_t *vertex);
+vertex_t *vertex_index_find(const vertex_index_t *index, const char *str);
+void vertex_index_clear(vertex_index_t *index);
+void vertex_index_remove(vertex_index_t *index, const vertex_t *vertex);
+
+/* frozen CSR snapshot */
+int graph_freeze_rows(const graph_t *graph, graph_csr_t *csr);
+int graph_freeze_contents(const graph_t *graph, graph_csr_t *csr);
+graph_csr_t *graph_freeze(const graph_t *graph);
+const char *graph_csr_content(const graph_csr_t *csr, size_t vertex);
+void graph_csr_delete(graph_csr_t *csr);
+size_t graph_csr_depth_first_traverse(const graph_csr_t *csr, void (*action)
+				      (const graph_csr_t *csr, size_t v,
+				       size_t depth));
+size_t graph_csr_breadth_first_traverse(const graph_csr_t *csr, void (*action)
+					(const graph_csr_t *csr, size_t v,
+					 size_t depth));
+
+/* direction-optimizing CSR breadth-first traversal */
+int graph_csr_add_reverse(graph_csr_t *csr);
+int bfs_frontier_init(bfs_frontier_t *frontier, size_t nb_vertices);
+void bfs_top_down_step(const graph_csr_t *csr, bfs_frontier_t *frontier,
+		       size_t end);
+void bfs_bottom_up_step(const graph_csr_t *csr, bfs_frontier_t *frontier,
+			size_t end);
+size_t graph_csr_breadth_first_hybrid(const graph_csr_t *csr, void (*action)
+				      (const graph_csr_t *csr, size_t v,
+				       size_t depth));
+
+/* multithreaded CSR breadth-first traversal */
+void parallel_bfs_flush(parallel_bfs_local_t *local);
+void parallel_bfs_expand(parallel_bfs_local_t *local, size_t v);
+void parallel_bfs_advance(parallel_bfs_t *bfs);
+void *parallel_bfs_worker(void *arg);
+int parallel_bfs_init(parallel_bfs_t *bfs, const graph_csr_t *csr);
+int parallel_bfs_start(parallel_bfs_t *bfs, pthread_t *threads,
+		       size_t nb_threads, size_t *created);
+size_t *graph_csr_parallel_bfs(const graph_csr_t *csr, size_t nb_threads);
+
+/* graph-owned slabs */
+void *graph_slab_alloc(graph_t *graph, size_t size);
+int graph_slab_insert(graph_t *graph, graph_slab_t *slab);
+int graph_slab_owns(const graph_t *graph, const void *ptr);
+void graph_slab_free(graph_t *graph);
+
+/* arena-backed graphs */
+graph_t *graph_create_arena(void);
+void *graph_alloc(graph_t *graph, size_t size);
+char *graph_strdup(graph_t *graph, const char *str);
+void graph_free(graph_t *graph, void *ptr);
+
+/* batch edge insertion */
+int batch_resolve(graph_t *graph, const edge_spec_t *edges, size_t count,
+		  int flags, edge_pair_t *pairs, size_t *nb_pairs);
+int edge_pair_cmp(const void *a, const void *b);
+size_t batch_dedup(const graph_t *graph, edge_pair_t *pairs,
+		   size_t nb_pairs);
+int batch_link(graph_t *graph, const edge_pair_t *pairs, size_t nb_pairs);
+int graph_add_edges_batch(graph_t *graph, const edge_spec_t *edges,
+			  size_t count, int flags);
+
+/* binary graph files */
+int graph_csr_save(const graph_csr_t *csr, const char *path);
+int graph_save(const graph_t *graph, const char *path);
+int graph_csr_check(const graph_csr_t *csr);
+int graph_file_check(const graph_file_header_t *header, size_t file_size);
+graph_csr_t *graph_csr_load(const char *path);
+void graph_csr_display(const graph_csr_t *csr);
+
+/* streaming edge list loader */
+int edge_reader_parse_line(edge_reader_t *reader, char *line, char *end);
+int edge_reader_flush(graph_t *graph, edge_reader_t *reader);
+int edge_reader_parse(graph_t *graph, edge_reader_t *reader, int eof);
+int graph_read_edge_list(graph_t *graph, int fd, edge_type_t type);
+graph_t *graph_load_edge_list(const char *path, edge_type_t type);
+
+/* weighted edges */
+int graph_set_weight_type(graph_t *graph, graph_weight_type_t type);
+size_t graph_edge_size(const graph_t *graph);
+int graph_connect_weighted(graph_t *graph, vertex_t *src_vertex,
+			   vertex_t *dest_vertex, graph_weight_t weight);
+int graph_add_weighted_edge(graph_t *graph, const char *src, const char *dest,
+			    edge_type_t type, graph_weight_t weight);
+int graph_freeze_weights(const graph_t *graph, graph_csr_t *csr);
+
+/* vertex relabeling */
+size_t *graph_order_by_degree(const graph_t *graph);
+int vertex_degree_cmp(const void *a, const void *b);
+size_t order_rcm_tree(vertex_t *root, vertex_t **queue, size_t tail,
+		      unsigned long *visited);
+size_t *graph_order_rcm(const graph_t *graph);
+int relabel_check(const size_t *perm, size_t n);
+void relabel_edges(graph_t *graph, const size_t *perm, vertex_t *vertices,
+		   char *block);
+void relabel_reverse(graph_t *graph, in_edge_t *in_edges);
+void relabel_vertices(graph_t *graph, const size_t *perm, vertex_t *vertices);
+int graph_relabel(graph_t *graph, const size_t *perm);
+
+/* statistics and profiling */
+size_t degree_bucket(size_t degree);
+void stats_memory(const graph_t *graph, graph_stats_t *stats);
+int graph_stats(const graph_t *graph, graph_stats_t *stats);
+void graph_set_counters(graph_t *graph, graph_counters_t *counters);
+void graph_count_traversal(const graph_t *graph, const unsigned long *visited,
+			   size_t allocations);
+
+/* buffered output */
+int graph_writer_init(graph_writer_t *writer, FILE *file, int fd,
+		      char *buffer, size_t size);
+int graph_writer_flush(graph_writer_t *writer);
+void graph_writer_put(graph_writer_t *writer, const char *str, size_t len);
+void graph_writer_ulong(graph_writer_t *writer, unsigned long n);
+int graph_writer_clear(graph_writer_t *writer);
+int graph_write(const graph_t *graph, graph_writer_t *writer);
+int graph_csr_write(const graph_csr_t *csr, graph_writer_t *writer);
+void dot_write_label(graph_writer_t *writer, const char *str);
+void dot_write_weight(graph_writer_t *writer, const graph_t *graph,
+		      const edge_t *edge);
+int graph_write_dot(const graph_t *graph, graph_writer_t *writer);
+
+/* concurrent graph builder */
+graph_builder_t *graph_builder_create(void);
+vertex_t *graph_builder_add_vertex(graph_builder_t *builder, const char *str);
+void builder_push_edge(vertex_t *src_vertex, edge_t *edge);
+int graph_builder_add_edge(graph_builder_t *builder, const char *src,
+			   const char *dest, edge_type_t type);
+void builder_free_shards(graph_builder_t *builder, size_t nb_shards);
+void builder_collect(graph_builder_t *builder, graph_t *graph);
+void builder_reverse_edges(vertex_t *vertex);
+graph_t *graph_builder_finish(graph_builder_t *builder);
+void graph_builder_delete(graph_builder_t *builder);
+
+/* edge hash set */
+size_t edge_set_hash(const vertex_t *src_vertex, const vertex_t *dest_vertex);
+edge_slot_t *edge_set_find(const edge_set_t *set, const vertex_t *src_vertex,
+			   const vertex_t *dest_vertex);
+int edge_set_reserve(edge_set_t *set, size_t count);
+void edge_set_add(edge_set_t *set, const vertex_t *src_vertex, edge_t *edge);
+void edge_set_remove(edge_set_t *set, const vertex_t *src_vertex,
+		     const edge_t *edge);
+int graph_track_edges(graph_t *graph);
+void graph_rehash_edges(graph_t *graph);
+void graph_clear_edges(graph_t *graph);
+int graph_set_unique_edges(graph_t *graph, int unique);
+edge_t *vertex_find_edge(const vertex_t *src_vertex,
+			 const vertex_t *dest_vertex);
+edge_t *graph_find_edge(const graph_t *graph, const vertex_t *src_vertex,
+			const vertex_t *dest_vertex);
+int graph_has_edge(const graph_t *graph, const char *src, const char *dest);
+int graph_get_edge_weight(const graph_t *graph, const char *src,
+			  const char *dest, graph_weight_t *weight);
+
+/* reverse adjacency */
+void vertex_link_in_edge(vertex_t *dest_vertex, edge_t *edge,
+			 vertex_t *src_vertex);
+void graph_link_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge,
+		     edge_t *in_edge);
+void reverse_move_edges(graph_t *graph, vertex_t *vertex, char **block,
+			size_t old_size);
+int graph_track_reverse(graph_t *graph);
+
+/* vertex and edge removal */
+void vertex_unlink_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge);
+void vertex_unlink_in_edge(vertex_t *dest_vertex, edge_t *in_edge);
+void graph_drop_edge(graph_t *graph, vertex_t *src_vertex, edge_t *edge);
+int graph_disconnect(graph_t *graph, vertex_t *src_vertex,
+		     vertex_t *dest_vertex);
+int graph_remove_edge(graph_t *graph, const char *src,
+		      const char *dest, edge_type_t type);
+void graph_detach_out_edges(graph_t *graph, vertex_t *vertex);
+void graph_detach_in_edges(graph_t *graph, vertex_t *vertex);
+void vertex_list_unlink(graph_t *graph, vertex_t *vertex);
+void graph_unlink_vertex(graph_t *graph, vertex_t *vertex);
+int graph_remove_vertex(graph_t *graph, const char *str);
+
+/* depth-first traversal engine */
+int dfs_engine_finish(dfs_engine_t *dfs, const vertex_t *vertex,
+		      size_t depth);
+int dfs_engine_discover(dfs_engine_t *dfs, vertex_t *vertex);
+int dfs_engine_follow(dfs_engine_t *dfs, dfs_frame_t *frame);
+int dfs_engine_run(dfs_engine_t *dfs, vertex_t *root);
+int graph_dfs(const graph_t *graph, vertex_t *start,
+	      const dfs_visitor_t *visitor);
+
+/* topological ordering */
+int topo_iter_init(topo_iter_t *iter, const graph_t *graph);
+vertex_t **topo_iter_next(topo_iter_t *iter, size_t *size);
+void topo_iter_clear(topo_iter_t *iter);
+vertex_t **graph_topological_sort(const graph_t *graph, size_t *nb_sorted);
+dfs_action_t cycle_search_pre(const vertex_t *v, size_t depth, void *data);
+dfs_action_t cycle_search_post(const vertex_t *v, size_t depth, void *data);
+dfs_action_t cycle_search_edge(const vertex_t *src, const vertex_t *dest,
+			       dfs_edge_kind_t kind, void *data);
+vertex_t **graph_find_cycle(const graph_t *graph, size_t *length);
+
+/* connected components */
+size_t components_find(size_t *parent, size_t v);
+void components_union(size_t *parent, size_t a, size_t b);
+size_t components_label(size_t *parent, size_t nb_vertices);
+size_t *graph_weak_components(const graph_t *graph, size_t *nb_components);
+int tarjan_visit(tarjan_t *tarjan, vertex_t *vertex);
+void tarjan_close(tarjan_t *tarjan, size_t v);
+int tarjan_run(tarjan_t *tarjan, vertex_t *root);
+size_t *graph_strong_components(const graph_t *graph,
+				size_t *nb_components);
+size_t components_find_shared(size_t *parent, size_t v);
+void components_union_shared(size_t *parent, size_t a, size_t b);
+void *parallel_components_worker(void *arg);
+size_t *graph_csr_weak_components_parallel(const graph_csr_t *csr,
+					   size_t nb_threads,
+					   size_t *nb_components);
+
 
 #endif /* GRAPHS_H */
@@ -41,7 +41,7 @@ int backtracker(queue_t **queue, int *saw, char **map, int rows,
 	    map[y][x] == '1' || *(saw + y * cols + x) == 1)
 		return (0);
 
-	printf("Checking coordinates [%d, %d]\n", x, y);
+	PATH_TRACE_CELL(x, y);
 	if (x == target->x && y == target->y)
 		return (point_push(queue, x, y));
 	*(saw + y * cols + x) = 1;
@@ -15,7 +15,7 @@ queue_node_t *graph_fill(queue_t *new_node, int *saw, const vertex_t *current,
 
 	if (current == NULL || saw[current->index] == 1)
 		return (NULL);
-	printf("Checking %s\n", current->content);
+	PATH_TRACE_VERTEX(current->content);
 	if (!strcmp(current->content, target))
 		return (queue_push_front(new_node, strdup(current->content)));
 	saw[current->index] = 1;
@@ -0,0 +1,125 @@
+#include "pathfinding.h"
+
+/**
+ * a_star_path - fills a queue with the path leading to a cell
+ * @search: search state
+ * @queue: queue to fill
+ * @cell: index of the last cell of the path
+ * Return: 1 if success, 0 if failed
+ */
+int a_star_path(a_star_t *search, queue_t *queue, size_t cell)
+{
+	while (1)
+	{
+		if (!point_push(&queue, cell % search->cols,
+				cell / search->cols))
+			return (0);
+		if (search->parent[cell] == cell)
+			return (1);
+		cell = search->parent[cell];
+	}
+}
+
+/**
+ * a_star_search - runs an A* search from a starting point
+ * @search: search state, whose map, size, target and moves are set
+ * @start: stores the coordinates of the starting point
+ * Description: cells leave the open set by increasing f-score; as the
+ * heuristic is consistent, a cell is expanded at most once, and entries
+ * left in the heap for cells already expanded are skipped when popped
+ * Return: queue of points from start to target, or NULL if there is no
+ * path or memory allocation failed
+ */
+queue_t *a_star_search(a_star_t *search, point_t const *start)
+{
+	size_t cell, goal;
+	queue_t *queue = NULL;
+	int ok;
+
+	cell = (size_t)start->y * search->cols + start->x;
+	goal = (size_t)search->target->y * search->cols + search->target->x;
+	ok = a_star_init(search, cell);
+	while (ok && search->size)
+	{
+		cell = heap_pop(search);
+		if (BIT_TEST(search->closed, cell))
+			continue;
+		BIT_SET(search->closed, cell);
+		PATH_TRACE_CELL((int)(cell % search->cols),
+				(int)(cell / search->cols));
+		if (cell == goal)
+			break;
+		ok = a_star_expand(search, cell);
+	}
+	if (ok && cell == goal)
+		queue = queue_create();
+	if (queue && !a_star_path(search, queue, cell))
+	{
+		queue_delete(queue);
+		queue = NULL;
+	}
+	free(search->g);
+	free(search->parent);
+	free(search->closed);
+	free(search->heap);
+	return (queue);
+}
+
+/**
+ * a_star_array - searches for the shortest path from a starting point to
+ * a target point within a two-dimensional array, with A*
+ * @map: pointer to a read-only two-dimensional array
+ * @rows: number of rows of @map
+ * @cols: number of cols of @map
+ * @start: stores the coordinates of the starting point
+ * @target: stores the coordinates of the target point
+ * Description: moves go right, bottom, left or top, as in
+ * backtracking_array, and the open set is guided by the Manhattan distance
+ * Return: queue, in which each node is a point in the path from start
+ * to target
+ */
+queue_t *a_star_array(char **map, int rows, int cols,
+		      point_t const *start, point_t const *target)
+{
+	a_star_t search = {NULL, 0, 0, NULL, 4, NULL, NULL, NULL, NULL, 0, 0};
+
+	if (!map || !*map || !start || !target || rows < 1 || cols < 1 ||
+	    !point_in_map(map, rows, cols, start) ||
+	    !point_in_map(map, rows, cols, target))
+		return (NULL);
+	search.map = map;
+	search.rows = rows;
+	search.cols = cols;
+	search.target = target;
+	return (a_star_search(&search, start));
+}
+
+/**
+ * a_star_array_octile - searches for the shortest path from a starting
+ * point to a target point within a two-dimensional array, with A*,
+ * allowing diagonal moves
+ * @map: pointer to a read-only two-dimensional array
+ * @rows: number of rows of @map
+ * @cols: number of cols of @map
+ * @start: stores the coordinates of the starting point
+ * @target: stores the coordinates of the target point
+ * Description: a diagonal move costs 1.4 straight moves and may not cut
+ * the corner of a wall; the open set is guided by the octile distance
+ * Return: queue, in which each node is a point in the path from start
+ * to target
+ */
+queue_t *a_star_array_octile(char **map, int rows, int cols,
+			     point_t const *start, point_t const *target)
+{
+	a_star_t search = {NULL, 0, 0, NULL, 8, NULL, NULL, NULL, NULL, 0, 0};
+
+	if (!map || !*map || !start || !target || rows < 1 || cols < 1 ||
+	    !point_in_map(map, rows, cols, start) ||
+	    !point_in_map(map, rows, cols, target))
+		return (NULL);
+	search.map = map;
+	search.rows = rows;
+	search.cols = cols;
+	search.target = target;
+	return (a_star_search(&search, start));
+}
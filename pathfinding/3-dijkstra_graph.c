@@ -0,0 +1,122 @@
+#include "pathfinding.h"
+
+/**
+ * dijkstra_relax - relaxes the edges leaving a settled vertex
+ * @heap: heap of the search, keyed by the distances of the vertices
+ * @vertex: settled vertex
+ * @parent: vertex preceding each vertex on its shortest known path
+ * Return: 1 if success, 0 if an edge has a negative weight
+ */
+int dijkstra_relax(dheap_t *heap, vertex_t const *vertex, size_t *parent)
+{
+	edge_t const *e;
+	size_t v;
+	long d;
+
+	for (e = vertex->edges; e; e = e->next)
+	{
+		if (e->weight < 0)
+			return (0);
+		v = e->dest->index;
+		d = heap->key[vertex->index] + e->weight;
+		if (heap->pos[v] == DHEAP_SETTLED ||
+		    (heap->pos[v] != DHEAP_ABSENT && d >= heap->key[v]))
+			continue;
+		parent[v] = vertex->index;
+		dheap_update(heap, v, d);
+	}
+	return (1);
+}
+
+/**
+ * dijkstra_path - builds the queue of the contents of the vertices on
+ * a shortest path
+ * @vertices: vertices of the graph, by index
+ * @parent: vertex preceding each vertex on its shortest path, the starting
+ * vertex being its own parent
+ * @target: index of the target vertex
+ * Return: queue, in which each node is a duplicated content, or NULL if
+ * memory allocation failed
+ */
+queue_t *dijkstra_path(vertex_t const **vertices, size_t const *parent,
+		       size_t target)
+{
+	queue_t *queue = queue_create();
+	char *content;
+	size_t v = target;
+
+	while (queue)
+	{
+		content = strdup(vertices[v]->content);
+		if (!content || !queue_push_front(queue, content))
+		{
+			free(content);
+			while ((content = dequeue(queue)))
+				free(content);
+			queue_delete(queue);
+			return (NULL);
+		}
+		if (parent[v] == v)
+			break;
+		v = parent[v];
+	}
+	return (queue);
+}
+
+/**
+ * dijkstra_graph - searches for the shortest path from a starting point to
+ * a target point in a weighted graph, with Dijkstra's algorithm
+ * @graph: pointer to the graph to go through
+ * @start: pointer to the starting vertex
+ * @target: pointer to the target vertex
+ * Description: distances and parents are flat arrays indexed by vertex
+ * index, and the vertices left to settle are kept in an indexed 4-ary
+ * heap with decrease-key; the search stops as soon as @target is settled;
+ * the weights of the edges must not be negative
+ * Return: queue, in which each node is a char * corresponding to a vertex,
+ * forming a path from start to target
+ */
+queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
+			vertex_t const *target)
+{
+	vertex_t const **vertices = NULL, *v;
+	dheap_t heap = {NULL, NULL, NULL, 0};
+	size_t *parent = NULL, n, i = DHEAP_ABSENT;
+	queue_t *queue = NULL;
+
+	if (!graph || !start || !target || !graph->nb_vertices)
+		return (NULL);
+	n = graph->nb_vertices;
+	vertices = malloc(n * sizeof(*vertices));
+	parent = malloc(n * sizeof(*parent));
+	heap.nodes = malloc(n * sizeof(*heap.nodes));
+	heap.pos = malloc(n * sizeof(*heap.pos));
+	heap.key = malloc(n * sizeof(*heap.key));
+	if (vertices && parent && heap.nodes && heap.key && heap.pos)
+	{
+		for (v = graph->vertices; v; v = v->next)
+		{
+			vertices[v->index] = v;
+			heap.pos[v->index] = DHEAP_ABSENT;
+		}
+		parent[start->index] = start->index;
+		dheap_update(&heap, start->index, 0);
+	}
+	while (heap.size && i != target->index)
+	{
+		i = dheap_pop(&heap);
+		PATH_TRACE_DISTANCE(vertices[i]->content, start->content,
+				    heap.key[i]);
+		if (i != target->index &&
+		    !dijkstra_relax(&heap, vertices[i], parent))
+			break;
+	}
+	if (i == target->index)
+		queue = dijkstra_path(vertices, parent, i);
+	free(vertices);
+	free(parent);
+	free(heap.nodes);
+	free(heap.pos);
+	free(heap.key);
+	return (queue);
+}
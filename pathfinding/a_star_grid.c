@@ -0,0 +1,106 @@
+#include "pathfinding.h"
+
+/**
+ * a_star_heuristic - estimates the cost from a cell to the target
+ * @search: search state
+ * @cell: index of the cell
+ * Description: Manhattan distance when only 4 moves are allowed, octile
+ * distance when diagonal moves are allowed too; both never overestimate
+ * the cost of the remaining path, so the path found is a shortest one
+ * Return: the estimated cost
+ */
+size_t a_star_heuristic(a_star_t const *search, size_t cell)
+{
+	size_t dx, dy, x = cell % search->cols, y = cell / search->cols;
+
+	dx = x > (size_t)search->target->x ? x - search->target->x :
+		search->target->x - x;
+	dy = y > (size_t)search->target->y ? y - search->target->y :
+		search->target->y - y;
+	if (search->moves == 4)
+		return (A_STAR_STRAIGHT * (dx + dy));
+	if (dx < dy)
+		return (A_STAR_STRAIGHT * dy +
+			(A_STAR_DIAGONAL - A_STAR_STRAIGHT) * dx);
+	return (A_STAR_STRAIGHT * dx +
+		(A_STAR_DIAGONAL - A_STAR_STRAIGHT) * dy);
+}
+
+/**
+ * a_star_expand - relaxes the neighbors of a cell leaving the open set
+ * @search: search state
+ * @cell: index of the cell
+ * Description: neighbors are tried right, bottom, left, top, then along
+ * the diagonals; a diagonal move may not cut the corner of a wall
+ * Return: 1 if success, 0 if failed
+ */
+int a_star_expand(a_star_t *search, size_t cell)
+{
+	int arr[][2] = {RIGHT, BOTTOM, LEFT, TOP,
+			{1, 1}, {-1, 1}, {-1, -1}, {1, -1}}, i, x, y;
+	size_t next, g, h;
+
+	for (i = 0; i < search->moves; i++)
+	{
+		x = cell % search->cols + arr[i][0];
+		y = cell / search->cols + arr[i][1];
+		if (x < 0 || x >= search->cols || y < 0 || y >= search->rows ||
+		    search->map[y][x] == '1')
+			continue;
+		if (i >= 4 && (search->map[y][x - arr[i][0]] == '1' ||
+			       search->map[y - arr[i][1]][x] == '1'))
+			continue;
+		next = (size_t)y * search->cols + x;
+		g = search->g[cell] +
+			(i < 4 ? A_STAR_STRAIGHT : A_STAR_DIAGONAL);
+		if (BIT_TEST(search->closed, next) || g >= search->g[next])
+			continue;
+		search->g[next] = g;
+		search->parent[next] = cell;
+		h = a_star_heuristic(search, next);
+		if (!heap_push(search, g + h, h, next))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * a_star_init - allocates the arrays of an A* search and opens its
+ * starting cell
+ * @search: search state, whose map, size, target and moves are set
+ * @cell: index of the starting cell
+ * Return: 1 if success, 0 if memory allocation failed, in which case the
+ * arrays allocated so far are left to be freed by the caller
+ */
+int a_star_init(a_star_t *search, size_t cell)
+{
+	size_t n = (size_t)search->rows * search->cols, i;
+
+	search->g = malloc(n * sizeof(*search->g));
+	search->parent = malloc(n * sizeof(*search->parent));
+	search->closed = calloc((n + BITS_PER_WORD - 1) / BITS_PER_WORD,
+				sizeof(*search->closed));
+	if (!search->g || !search->parent || !search->closed)
+		return (0);
+
+	for (i = 0; i < n; i++)
+		search->g[i] = A_STAR_UNSEEN;
+	search->g[cell] = 0;
+	search->parent[cell] = cell;
+	return (heap_push(search, a_star_heuristic(search, cell), 0, cell));
+}
+
+/**
+ * point_in_map - checks that a point is a free cell of a map
+ * @map: pointer to a read-only two-dimensional array
+ * @rows: number of rows of @map
+ * @cols: number of cols of @map
+ * @point: point to check
+ * Return: 1 if @point lies within @map on a cell that is not a wall,
+ * 0 otherwise
+ */
+int point_in_map(char **map, int rows, int cols, point_t const *point)
+{
+	return (point->x >= 0 && point->x < cols && point->y >= 0 &&
+		point->y < rows && map[point->y][point->x] != '1');
+}
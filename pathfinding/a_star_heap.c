@@ -0,0 +1,78 @@
+#include "pathfinding.h"
+
+/**
+ * heap_less - compares two entries of the open set of an A* search
+ * @a: first entry
+ * @b: second entry
+ * Description: ties on the f-score are broken in favor of the entry closer
+ * to the target, which expands fewer cells on open maps
+ * Return: 1 if @a must be expanded before @b, 0 otherwise
+ */
+int heap_less(heap_entry_t const *a, heap_entry_t const *b)
+{
+	if (a->f != b->f)
+		return (a->f < b->f);
+	return (a->h < b->h);
+}
+
+/**
+ * heap_push - inserts a cell in the open set of an A* search
+ * @search: search state
+ * @f: f-score of the cell
+ * @h: h-score of the cell
+ * @cell: index of the cell
+ * Return: 1 if success, 0 if failed
+ */
+int heap_push(a_star_t *search, size_t f, size_t h, size_t cell)
+{
+	heap_entry_t *heap = search->heap, entry;
+	size_t i, parent, capacity;
+
+	if (search->size == search->capacity)
+	{
+		capacity = search->capacity ? search->capacity * 2 : 256;
+		heap = realloc(heap, capacity * sizeof(*heap));
+		if (!heap)
+			return (0);
+		search->heap = heap;
+		search->capacity = capacity;
+	}
+	entry.f = f;
+	entry.h = h;
+	entry.cell = cell;
+	for (i = search->size++; i > 0; i = parent)
+	{
+		parent = (i - 1) / 2;
+		if (!heap_less(&entry, &heap[parent]))
+			break;
+		heap[i] = heap[parent];
+	}
+	heap[i] = entry;
+	return (1);
+}
+
+/**
+ * heap_pop - removes the entry with the lowest f-score from the open set
+ * of an A* search
+ * @search: search state, whose open set must not be empty
+ * Return: the index of the cell of the removed entry
+ */
+size_t heap_pop(a_star_t *search)
+{
+	heap_entry_t *heap = search->heap, last;
+	size_t cell = heap[0].cell, i = 0, child;
+
+	last = heap[--search->size];
+	while ((child = 2 * i + 1) < search->size)
+	{
+		if (child + 1 < search->size &&
+		    heap_less(&heap[child + 1], &heap[child]))
+			child++;
+		if (!heap_less(&heap[child], &last))
+			break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = last;
+	return (cell);
+}
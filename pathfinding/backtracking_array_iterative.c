@@ -0,0 +1,131 @@
+#include "pathfinding.h"
+
+/**
+ * search_push - pushes a frame on the stack of a search, growing it
+ * @search: search state
+ * @frame: frame to push
+ * Return: 1 if success, 0 if failed
+ */
+int search_push(array_search_t *search, size_t frame)
+{
+	size_t *stack;
+
+	if (search->size == search->capacity)
+	{
+		search->capacity = search->capacity ? search->capacity * 2 : 64;
+		stack = realloc(search->stack,
+				search->capacity * sizeof(*stack));
+		if (!stack)
+			return (0);
+		search->stack = stack;
+	}
+	search->stack[search->size++] = frame << 3;
+	return (1);
+}
+
+/**
+ * search_enter - checks a cell, as one call of backtracker would
+ * @search: search state
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ * Return: 2 if the cell is the target, 1 if it was pushed on the stack,
+ * 0 if it cannot be walked on, -1 if memory allocation failed
+ */
+int search_enter(array_search_t *search, int x, int y)
+{
+	size_t cell;
+
+	if (x < 0 || x >= search->cols || y < 0 || y >= search->rows ||
+	    search->map[y][x] == '1')
+		return (0);
+	cell = (size_t)y * search->cols + x;
+	if (BIT_TEST(search->saw, cell))
+		return (0);
+
+	PATH_TRACE_CELL(x, y);
+	if (x == search->target->x && y == search->target->y)
+		return (2);
+	BIT_SET(search->saw, cell);
+	return (search_push(search, cell) ? 1 : -1);
+}
+
+/**
+ * search_path - fills a queue with the path held by the stack of a search,
+ * once its target has been reached
+ * @search: search state
+ * @queue: queue to fill
+ * Return: 1 if success, 0 if failed
+ */
+int search_path(array_search_t *search, queue_t *queue)
+{
+	size_t i, cell;
+
+	if (!point_push(&queue, search->target->x, search->target->y))
+		return (0);
+	for (i = search->size; i > 0; i--)
+	{
+		cell = search->stack[i - 1] >> 3;
+		if (!point_push(&queue, cell % search->cols,
+				cell / search->cols))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * backtracking_array_iterative - searches for the first path from a starting
+ * point to a target point within a two-dimensional array, without recursion
+ * @map: pointer to a read-only two-dimensional array
+ * @rows: number of rows of @map
+ * @cols: number of cols of @map
+ * @start: stores the coordinates of the starting point
+ * @target: stores the coordinates of the target point
+ * Description: cells are checked in the same order as backtracking_array,
+ * but the path being explored lives in a heap-allocated stack, and the
+ * checked cells in a bitmap, so large maps neither overflow the C stack
+ * nor need an int per cell
+ * Return: queue, in which each node is a point in the path from start
+ * to target
+ */
+queue_t *backtracking_array_iterative(char **map, int rows, int cols,
+				      point_t const *start,
+				      point_t const *target)
+{
+	int arr[][2] = {RIGHT, BOTTOM, LEFT, TOP}, ret, d;
+	array_search_t search = {NULL, 0, 0, NULL, NULL, NULL, 0, 0};
+	queue_t *queue = NULL;
+	size_t *top;
+
+	if (!map || !*map || !start || !target || rows < 1 || cols < 1)
+		return (NULL);
+	search.map = map;
+	search.rows = rows;
+	search.cols = cols;
+	search.target = target;
+	search.saw = calloc(((size_t)rows * cols + BITS_PER_WORD - 1) /
+			    BITS_PER_WORD, sizeof(*search.saw));
+	ret = search.saw ? search_enter(&search, start->x, start->y) : -1;
+	while (ret >= 0 && ret < 2 && search.size)
+	{
+		top = &search.stack[search.size - 1];
+		d = *top & 7;
+		if (d == 4)
+		{
+			search.size--;
+			continue;
+		}
+		(*top)++;
+		ret = search_enter(&search, (*top >> 3) % cols + arr[d][0],
+				   (*top >> 3) / cols + arr[d][1]);
+	}
+	if (ret == 2)
+		queue = queue_create();
+	if (queue && !search_path(&search, queue))
+	{
+		queue_delete(queue);
+		queue = NULL;
+	}
+	free(search.saw);
+	free(search.stack);
+	return (queue);
+}
@@ -0,0 +1,90 @@
+#include "pathfinding.h"
+
+/**
+ * dheap_sift_up - moves an entry of an indexed 4-ary heap up to its place
+ * @heap: heap
+ * @i: position of the entry in the heap
+ */
+void dheap_sift_up(dheap_t *heap, size_t i)
+{
+	size_t v = heap->nodes[i], parent;
+
+	for (; i > 0; i = parent)
+	{
+		parent = (i - 1) / DHEAP_ARITY;
+		if (heap->key[heap->nodes[parent]] <= heap->key[v])
+			break;
+		heap->nodes[i] = heap->nodes[parent];
+		heap->pos[heap->nodes[i]] = i;
+	}
+	heap->nodes[i] = v;
+	heap->pos[v] = i;
+}
+
+/**
+ * dheap_sift_down - moves an entry of an indexed 4-ary heap down to its
+ * place
+ * @heap: heap
+ * @i: position of the entry in the heap
+ * Description: with four children per node the heap is half as deep as
+ * a binary one, so decrease-key, which only sifts up, is cheaper, for
+ * a few more comparisons per level when popping
+ */
+void dheap_sift_down(dheap_t *heap, size_t i)
+{
+	size_t v = heap->nodes[i], child, best, end;
+
+	while ((child = DHEAP_ARITY * i + 1) < heap->size)
+	{
+		end = child + DHEAP_ARITY < heap->size ?
+			child + DHEAP_ARITY : heap->size;
+		for (best = child++; child < end; child++)
+			if (heap->key[heap->nodes[child]] <
+			    heap->key[heap->nodes[best]])
+				best = child;
+		if (heap->key[heap->nodes[best]] >= heap->key[v])
+			break;
+		heap->nodes[i] = heap->nodes[best];
+		heap->pos[heap->nodes[i]] = i;
+		i = best;
+	}
+	heap->nodes[i] = v;
+	heap->pos[v] = i;
+}
+
+/**
+ * dheap_update - inserts a vertex in an indexed 4-ary heap, or lowers its
+ * key if it is already in it
+ * @heap: heap, whose arrays are sized for every vertex of the graph
+ * @v: index of the vertex, which must not be settled
+ * @key: new key of the vertex, lower than its current one
+ */
+void dheap_update(dheap_t *heap, size_t v, long key)
+{
+	heap->key[v] = key;
+	if (heap->pos[v] == DHEAP_ABSENT)
+	{
+		heap->nodes[heap->size] = v;
+		heap->pos[v] = heap->size++;
+	}
+	dheap_sift_up(heap, heap->pos[v]);
+}
+
+/**
+ * dheap_pop - removes the vertex with the lowest key from an indexed
+ * 4-ary heap
+ * @heap: heap, which must not be empty
+ * Return: the index of the removed vertex, now marked settled
+ */
+size_t dheap_pop(dheap_t *heap)
+{
+	size_t v = heap->nodes[0];
+
+	heap->pos[v] = DHEAP_SETTLED;
+	if (--heap->size)
+	{
+		heap->nodes[0] = heap->nodes[heap->size];
+		dheap_sift_down(heap, 0);
+	}
+	return (v);
+}
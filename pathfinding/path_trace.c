@@ -0,0 +1,67 @@
+#include "pathfinding.h"
+
+/**
+ * trace_stdout_cell - prints a checked cell on stdout
+ * @data: unused
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ */
+void trace_stdout_cell(void *data, int x, int y)
+{
+	(void)data;
+	printf("Checking coordinates [%d, %d]\n", x, y);
+}
+
+/**
+ * trace_stdout_vertex - prints a checked vertex on stdout
+ * @data: unused
+ * @content: content of the vertex
+ */
+void trace_stdout_vertex(void *data, char const *content)
+{
+	(void)data;
+	printf("Checking %s\n", content);
+}
+
+/* Tracer every thread starts with, and tracer of the calling thread */
+static path_tracer_t const trace_stdout = {
+	trace_stdout_cell, trace_stdout_vertex, trace_stdout_distance, NULL
+};
+__thread path_tracer_t const *trace_current = &trace_stdout;
+
+/**
+ * path_trace_set - sets the tracer of the searches run by the calling thread
+ * @tracer: tracer to use, or NULL to search without any output
+ * Description: every thread starts with a tracer printing the checked
+ * cells and vertices on stdout; the tracer is not copied, it must stay
+ * valid while it is set
+ * Return: the previous tracer of the thread
+ */
+path_tracer_t const *path_trace_set(path_tracer_t const *tracer)
+{
+	path_tracer_t const *previous = trace_current;
+
+	trace_current = tracer;
+	return (previous);
+}
+
+/**
+ * path_trace_cell - reports a checked cell to the tracer of the thread
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ */
+void path_trace_cell(int x, int y)
+{
+	if (trace_current && trace_current->cell)
+		trace_current->cell(trace_current->data, x, y);
+}
+
+/**
+ * path_trace_vertex - reports a checked vertex to the tracer of the thread
+ * @content: content of the vertex
+ */
+void path_trace_vertex(char const *content)
+{
+	if (trace_current && trace_current->vertex)
+		trace_current->vertex(trace_current->data, content);
+}
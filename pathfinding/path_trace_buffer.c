@@ -0,0 +1,84 @@
+#include "pathfinding.h"
+
+/**
+ * path_trace_buffer_init - initializes a buffered sink and a tracer
+ * writing to it
+ * @buffer: sink to initialize
+ * @tracer: tracer to point to @buffer, to be set with path_trace_set
+ * @file: stream the trace is written to
+ * Description: the lines are the same as the ones printed by default, but
+ * they are formatted into @buffer and written to @file a block at a time,
+ * without going through stdio for each checked cell or vertex
+ */
+void path_trace_buffer_init(path_trace_buffer_t *buffer,
+			    path_tracer_t *tracer, FILE *file)
+{
+	buffer->file = file;
+	buffer->len = 0;
+	tracer->cell = trace_buffer_cell;
+	tracer->vertex = trace_buffer_vertex;
+	tracer->distance = trace_buffer_distance;
+	tracer->data = buffer;
+}
+
+/**
+ * path_trace_buffer_flush - writes out the bytes waiting in a sink
+ * @buffer: sink to flush
+ * Return: 1 if success, 0 if the write failed
+ */
+int path_trace_buffer_flush(path_trace_buffer_t *buffer)
+{
+	size_t len = buffer->len;
+
+	buffer->len = 0;
+	if (!len)
+		return (1);
+	return (fwrite(buffer->data, 1, len, buffer->file) == len);
+}
+
+/**
+ * path_trace_buffer_write - appends bytes to a sink, flushing it when full
+ * @buffer: sink to write to
+ * @str: bytes to append
+ * @len: number of bytes in @str
+ */
+void path_trace_buffer_write(path_trace_buffer_t *buffer, char const *str,
+			     size_t len)
+{
+	if (buffer->len + len > PATH_TRACE_BUFFER)
+		path_trace_buffer_flush(buffer);
+	if (len > PATH_TRACE_BUFFER)
+	{
+		fwrite(str, 1, len, buffer->file);
+		return;
+	}
+	memcpy(buffer->data + buffer->len, str, len);
+	buffer->len += len;
+}
+
+/**
+ * trace_buffer_cell - formats a checked cell into a sink
+ * @data: sink to write to
+ * @x: X coordinate of the cell
+ * @y: Y coordinate of the cell
+ */
+void trace_buffer_cell(void *data, int x, int y)
+{
+	char line[64];
+	int len;
+
+	len = sprintf(line, "Checking coordinates [%d, %d]\n", x, y);
+	path_trace_buffer_write(data, line, len);
+}
+
+/**
+ * trace_buffer_vertex - formats a checked vertex into a sink
+ * @data: sink to write to
+ * @content: content of the vertex
+ */
+void trace_buffer_vertex(void *data, char const *content)
+{
+	path_trace_buffer_write(data, "Checking ", 9);
+	path_trace_buffer_write(data, content, strlen(content));
+	path_trace_buffer_write(data, "\n", 1);
+}
@@ -0,0 +1,54 @@
+#include "pathfinding.h"
+
+/**
+ * trace_stdout_distance - prints a checked vertex and its distance from
+ * the starting vertex on stdout
+ * @data: unused
+ * @content: content of the vertex
+ * @start: content of the starting vertex
+ * @distance: distance from @start to the vertex
+ */
+void trace_stdout_distance(void *data, char const *content,
+			   char const *start, long distance)
+{
+	(void)data;
+	printf("Checking %s, distance from %s is %ld\n", content, start,
+	       distance);
+}
+
+/**
+ * trace_buffer_distance - formats a checked vertex and its distance from
+ * the starting vertex into a sink
+ * @data: sink to write to
+ * @content: content of the vertex
+ * @start: content of the starting vertex
+ * @distance: distance from @start to the vertex
+ */
+void trace_buffer_distance(void *data, char const *content,
+			   char const *start, long distance)
+{
+	char number[32];
+	int len;
+
+	path_trace_buffer_write(data, "Checking ", 9);
+	path_trace_buffer_write(data, content, strlen(content));
+	path_trace_buffer_write(data, ", distance from ", 16);
+	path_trace_buffer_write(data, start, strlen(start));
+	len = sprintf(number, " is %ld\n", distance);
+	path_trace_buffer_write(data, number, len);
+}
+
+/**
+ * path_trace_distance - reports a checked vertex and its distance from
+ * the starting vertex to the tracer of the thread
+ * @content: content of the vertex
+ * @start: content of the starting vertex
+ * @distance: distance from @start to the vertex
+ */
+void path_trace_distance(char const *content, char const *start,
+			 long distance)
+{
+	if (trace_current && trace_current->distance)
+		trace_current->distance(trace_current->data, content, start,
+					distance);
+}
@@ -31,6 +31,201 @@ typedef struct point_s
 
 
 
+#define BITS_PER_WORD (sizeof(unsigned long) * CHAR_BIT)
+#define BIT_TEST(set, i) \
+	((set)[(i) / BITS_PER_WORD] >> ((i) % BITS_PER_WORD) & 1)
+#define BIT_SET(set, i) \
+	((set)[(i) / BITS_PER_WORD] |= 1UL << ((i) % BITS_PER_WORD))
+
+#define PATH_TRACE_BUFFER 4096
+
+#define A_STAR_STRAIGHT 10
+#define A_STAR_DIAGONAL 14
+#define A_STAR_UNSEEN ((size_t)-1)
+
+#define DHEAP_ARITY 4
+#define DHEAP_ABSENT ((size_t)-1)
+#define DHEAP_SETTLED ((size_t)-2)
+
+#ifdef PATHFINDING_QUIET
+#define PATH_TRACE_CELL(x, y) ((void)0)
+#define PATH_TRACE_VERTEX(content) ((void)0)
+#define PATH_TRACE_DISTANCE(content, start, distance) ((void)0)
+#else
+#define PATH_TRACE_CELL(x, y) path_trace_cell(x, y)
+#define PATH_TRACE_VERTEX(content) path_trace_vertex(content)
+#define PATH_TRACE_DISTANCE(content, start, distance) \
+	path_trace_distance(content, start, distance)
+#endif
+
+
+/**
+ * struct path_tracer_s - Hook receiving the cells and vertices checked
+ * by the searches, in the order they are checked
+ *
+ * @cell: Called with @data and the coordinates of each checked cell,
+ * may be NULL
+ * @vertex: Called with @data and the content of each checked vertex,
+ * may be NULL
+ * @distance: Called with @data, the content of each checked vertex, the
+ * content of the starting vertex and the distance between them, for the
+ * searches that compute distances, may be NULL
+ * @data: Opaque pointer handed to the callbacks
+ */
+
+typedef struct path_tracer_s
+{
+	void (*cell)(void *data, int x, int y);
+	void (*vertex)(void *data, char const *content);
+	void (*distance)(void *data, char const *content, char const *start,
+			 long distance);
+	void *data;
+} path_tracer_t;
+
+
+
+/**
+ * struct path_trace_buffer_s - Buffered sink for the trace of a search
+ *
+ * @file: Stream the trace is written to when the buffer is flushed
+ * @len: Number of bytes waiting in @data
+ * @data: Bytes not written yet
+ */
+
+typedef struct path_trace_buffer_s
+{
+	FILE *file;
+	size_t len;
+	char data[PATH_TRACE_BUFFER];
+} path_trace_buffer_t;
+
+
+
+/**
+ * struct heap_entry_s - Entry of the open set of an A* search
+ *
+ * @f: Estimated cost of the path through the cell (g-score + @h)
+ * @h: Heuristic estimate of the cost from the cell to the target
+ * @cell: Index of the cell (y * cols + x)
+ */
+
+typedef struct heap_entry_s
+{
+	size_t f;
+	size_t h;
+	size_t cell;
+} heap_entry_t;
+
+
+
+/**
+ * struct a_star_s - State of an A* search on a two-dimensional array
+ *
+ * @map: Map or maze being searched
+ * @rows: Height of @map
+ * @cols: Width of @map
+ * @target: Target point
+ * @moves: Number of moves allowed from a cell, 4 or 8 (with diagonals)
+ * @g: Cost of the best path found so far to each cell, A_STAR_UNSEEN if
+ * the cell has not been reached yet
+ * @parent: Cell preceding each cell on its best path
+ * @closed: Bit-packed map of the cells already expanded
+ * @heap: Open set, a binary min-heap ordered by f-score then h-score,
+ * which may hold stale entries for cells reached again at a lower cost
+ * @size: Number of entries in @heap
+ * @capacity: Number of entries @heap can hold
+ */
+
+typedef struct a_star_s
+{
+	char **map;
+	int rows;
+	int cols;
+	point_t const *target;
+	int moves;
+	size_t *g;
+	size_t *parent;
+	unsigned long *closed;
+	heap_entry_t *heap;
+	size_t size;
+	size_t capacity;
+} a_star_t;
+
+
+
+/**
+ * struct dheap_s - Indexed 4-ary min-heap of vertex indices, keyed by their
+ * distance from the start of a Dijkstra search
+ *
+ * @nodes: Vertex indices, the children of @nodes[i] being
+ * @nodes[DHEAP_ARITY * i + 1] to @nodes[DHEAP_ARITY * i + DHEAP_ARITY]
+ * @pos: Position of each vertex in @nodes, DHEAP_ABSENT if it was never
+ * inserted, DHEAP_SETTLED once it has been popped
+ * @key: Distance of each vertex, the key of the heap
+ * @size: Number of vertices in @nodes
+ */
+
+typedef struct dheap_s
+{
+	size_t *nodes;
+	size_t *pos;
+	long *key;
+	size_t size;
+} dheap_t;
+
+
+
+/**
+ * struct array_search_s - State of an iterative backtracking search
+ *
+ * @map: Map or maze being searched
+ * @rows: Height of @map
+ * @cols: Width of @map
+ * @target: Target point
+ * @saw: Bit-packed map of the cells already checked, one bit per cell
+ * @stack: Explicit stack of frames, each frame packs the index of a cell
+ * (y * cols + x) shifted left by 3, and the next direction to try
+ * @size: Number of frames in @stack
+ * @capacity: Number of frames @stack can hold
+ */
+
+typedef struct array_search_s
+{
+	char **map;
+	int rows;
+	int cols;
+	point_t const *target;
+	unsigned long *saw;
+	size_t *stack;
+	size_t size;
+	size_t capacity;
+} array_search_t;
+
+
+
+extern __thread path_tracer_t const *trace_current;
+
+/* tracing */
+path_tracer_t const *path_trace_set(path_tracer_t const *tracer);
+void path_trace_cell(int x, int y);
+void path_trace_vertex(char const *content);
+void trace_stdout_cell(void *data, int x, int y);
+void trace_stdout_vertex(void *data, char const *content);
+void path_trace_buffer_init(path_trace_buffer_t *buffer,
+			    path_tracer_t *tracer, FILE *file);
+int path_trace_buffer_flush(path_trace_buffer_t *buffer);
+void path_trace_buffer_write(path_trace_buffer_t *buffer, char const *str,
+			     size_t len);
+void trace_buffer_cell(void *data, int x, int y);
+void trace_buffer_vertex(void *data, char const *content);
+void path_trace_distance(char const *content, char const *start,
+			 long distance);
+void trace_stdout_distance(void *data, char const *content,
+			   char const *start, long distance);
+void trace_buffer_distance(void *data, char const *content,
+			   char const *start, long distance);
+
+
 /* task 0 */
 queue_t *backtracking_array(char **map, int rows, int cols,
 			    point_t const *start, point_t const *target);
@@ -38,6 +233,13 @@ int point_push(queue_t **queue, int x, int y);
 int backtracker(queue_t **queue, int *saw, char **map, int rows,
 		int cols, int x, int y, point_t const *target);
 
+queue_t *backtracking_array_iterative(char **map, int rows, int cols,
+				      point_t const *start,
+				      point_t const *target);
+int search_push(array_search_t *search, size_t frame);
+int search_enter(array_search_t *search, int x, int y);
+int search_path(array_search_t *search, queue_t *queue);
+
 
 /* task 1 */
 queue_node_t *graph_fill(queue_t *new_node, int *saw, const vertex_t *current,
@@ -47,6 +249,31 @@ queue_t *backtracking_graph(graph_t *graph, vertex_t const *start,
 
 
 /* task 2 */
+queue_t *a_star_array(char **map, int rows, int cols,
+		      point_t const *start, point_t const *target);
+queue_t *a_star_array_octile(char **map, int rows, int cols,
+			     point_t const *start, point_t const *target);
+int point_in_map(char **map, int rows, int cols, point_t const *point);
+queue_t *a_star_search(a_star_t *search, point_t const *start);
+int a_star_path(a_star_t *search, queue_t *queue, size_t cell);
+size_t a_star_heuristic(a_star_t const *search, size_t cell);
+int a_star_expand(a_star_t *search, size_t cell);
+int a_star_init(a_star_t *search, size_t cell);
+int heap_less(heap_entry_t const *a, heap_entry_t const *b);
+int heap_push(a_star_t *search, size_t f, size_t h, size_t cell);
+size_t heap_pop(a_star_t *search);
+
+
+/* task 3 */
+queue_t *dijkstra_graph(graph_t *graph, vertex_t const *start,
+			vertex_t const *target);
+int dijkstra_relax(dheap_t *heap, vertex_t const *vertex, size_t *parent);
+queue_t *dijkstra_path(vertex_t const **vertices, size_t const *parent,
+		       size_t target);
+void dheap_sift_up(dheap_t *heap, size_t i);
+void dheap_sift_down(dheap_t *heap, size_t i);
+void dheap_update(dheap_t *heap, size_t v, long key);
+size_t dheap_pop(dheap_t *heap);
 
 
 #endif /* PATHFINDING_H */